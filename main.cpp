@@ -28,6 +28,74 @@ namespace PublishAsyncDemo {
 void RunAll();
 }
 
+namespace TaskCacheDemo {
+void RunAll();
+}
+
+namespace FalseSharingBenchmark {
+void RunAll();
+}
+
+namespace StaticEventBusDemo {
+void RunAll();
+}
+
+namespace EventBatchDemo {
+void RunAll();
+}
+
+namespace EventReplayDemo {
+void RunAll();
+}
+
+namespace EventBridgeDemo {
+void RunAll();
+}
+
+namespace StressDemo {
+void RunAll();
+}
+
+namespace DeadlineDemo {
+void RunAll();
+}
+
+namespace TimerDemo {
+void RunAll();
+}
+
+namespace TaskGraphProfilerDemo {
+void RunAll();
+}
+
+namespace FiberDemo {
+void RunAll();
+}
+
+namespace ShutdownDemo {
+void RunAll();
+}
+
+namespace ValueForwardingDemo {
+void RunAll();
+}
+
+namespace ResultAccessDemo {
+void RunAll();
+}
+
+namespace ParallelAlgorithmsDemo {
+void RunAll();
+}
+
+namespace ShardedEventBusDemo {
+void RunAll();
+}
+
+namespace CancellableAwaitDemo {
+void RunAll();
+}
+
 int main() {
   RunAllDemo();
   RunAllCoroutineDemos();
@@ -40,5 +108,22 @@ int main() {
   CollisionFilterDemo::RunAll();
   EventScopeDemo::RunAll();
   PublishAsyncDemo::RunAll();
+  TaskCacheDemo::RunAll();
+  FalseSharingBenchmark::RunAll();
+  StaticEventBusDemo::RunAll();
+  EventBatchDemo::RunAll();
+  EventReplayDemo::RunAll();
+  EventBridgeDemo::RunAll();
+  StressDemo::RunAll();
+  DeadlineDemo::RunAll();
+  TimerDemo::RunAll();
+  TaskGraphProfilerDemo::RunAll();
+  FiberDemo::RunAll();
+  ShutdownDemo::RunAll();
+  ValueForwardingDemo::RunAll();
+  ResultAccessDemo::RunAll();
+  ParallelAlgorithmsDemo::RunAll();
+  ShardedEventBusDemo::RunAll();
+  CancellableAwaitDemo::RunAll();
   return 0;
 }
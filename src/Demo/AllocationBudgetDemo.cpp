@@ -0,0 +1,325 @@
+/**
+ * @file AllocationBudgetDemo.cpp
+ * @brief Checks heap allocation budgets for the EventBus, Task, TaskAwaiter and ThreadPool hot paths.
+ * @details Replaces the global operator new/delete with versions that bump per-thread counters, then measures the
+ *          calling thread (and, for task chains, the single pool worker) across steady-state operations.
+ *          A budget failure means a change in EventBus.hpp, Task.hpp or ThreadPool.hpp started allocating on a
+ *          path that used not to.
+ * @note Built as its own alloc_budget_tests executable so the replacement never reaches app; exits nonzero when a
+ *       budget is exceeded, independent of NDEBUG
+ */
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include "CoroTask.hpp"
+#include "EventBus.hpp"
+#include "Events.hpp"
+#include "SubjectID.hpp"
+#include "Task.hpp"
+#include "TaskAwaiter.hpp"
+#include "ThreadPool.hpp"
+
+// GCC sees std::free inlined into the replaced operator delete and flags it against operator new
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace {
+
+thread_local uint64_t t_allocation_count = 0;
+
+void* CountedAllocate(std::size_t size) {
+  ++t_allocation_count;
+
+  void* memory = std::malloc(size == 0 ? 1 : size);
+  if (!memory) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+// MSVC has no std::aligned_alloc, and _aligned_malloc memory must go back through _aligned_free
+void* CountedAlignedAllocate(std::size_t size, std::align_val_t alignment) {
+  ++t_allocation_count;
+
+  const auto align = static_cast<std::size_t>(alignment);
+  size = size == 0 ? 1 : size;
+#ifdef _WIN32
+  void* memory = _aligned_malloc(size, align);
+#else
+  void* memory = std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+  if (!memory) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void AlignedFree(void* memory) noexcept {
+#ifdef _WIN32
+  _aligned_free(memory);
+#else
+  std::free(memory);
+#endif
+}
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  return CountedAllocate(size);
+}
+
+void* operator new[](std::size_t size) {
+  return CountedAllocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return CountedAlignedAllocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return CountedAlignedAllocate(size, alignment);
+}
+
+void operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+  AlignedFree(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept {
+  AlignedFree(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept {
+  AlignedFree(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept {
+  AlignedFree(memory);
+}
+
+namespace AllocationBudgetDemo {
+
+// Allocations made by the current thread since construction
+class AllocationScope {
+ public:
+  AllocationScope() : start_(t_allocation_count) {
+  }
+
+  uint64_t Count() const {
+    return t_allocation_count - start_;
+  }
+
+ private:
+  uint64_t start_;
+};
+
+// Explicit checks rather than assert, so a release or sanitizer build still fails on a regression
+bool g_failed = false;
+
+void Check(bool condition, const char* what) {
+  if (!condition) {
+    std::cout << "  FAIL: " << what << "\n";
+    g_failed = true;
+  }
+}
+
+void CheckBudget(const char* path, uint64_t allocations, uint64_t operations, uint64_t budget) {
+  std::cout << "  " << path << ": " << allocations << " allocations over " << operations << " ops (budget " << budget << ")\n";
+  if (allocations > budget) {
+    std::cout << "  FAIL: " << path << " exceeded its allocation budget\n";
+    g_failed = true;
+  }
+}
+
+// Tests that steady-state Emit reuses the cached handler snapshot
+void TestEmit() {
+  std::cout << "\nTest 1: Emit\n";
+
+  ThreadPool pool(1);
+  auto bus = std::make_shared<EventBus>(pool);
+  int calls = 0;
+  std::vector<EventHandle> handles;
+  for (int i = 0; i < 4; ++i) {
+    handles.push_back(bus->Subscribe<PlayerDamagedEvent>([&calls](const PlayerDamagedEvent&) { calls++; }));
+  }
+  bus->Emit(PlayerDamagedEvent{.player_id = 1, .damage = 1.0f});  // builds the snapshot
+
+  constexpr int kEmits = 1000;
+  AllocationScope scope;
+  for (int i = 0; i < kEmits; ++i) {
+    bus->Emit(PlayerDamagedEvent{.player_id = 1, .damage = 1.0f});
+  }
+  CheckBudget("Emit", scope.Count(), kEmits, 0);
+  Check(calls == 4 * (kEmits + 1), "every Emit reached every handler");
+}
+
+// Tests that steady-state EmitTargeted allocates nothing, for subscribed and unsubscribed targets alike
+void TestEmitTargeted() {
+  std::cout << "\nTest 2: EmitTargeted\n";
+
+  ThreadPool pool(1);
+  auto bus = std::make_shared<EventBus>(pool);
+  int calls = 0;
+  auto handle = bus->SubscribeTargeted<CollisionEvent>(SubjectID(7), [&calls](const CollisionEvent&) { calls++; });
+
+  CollisionEvent event{.entity_a_id = 7, .entity_b_id = 8, .category_a = EntityCategory::Player, .category_b = EntityCategory::Wall, .force = 1.0f};
+  bus->EmitTargeted(event, SubjectID(7));
+
+  constexpr int kEmits = 1000;
+  AllocationScope scope;
+  for (int i = 0; i < kEmits; ++i) {
+    bus->EmitTargeted(event, SubjectID(7));
+    bus->EmitTargeted(event, SubjectID(static_cast<uint64_t>(1000 + i)));  // nobody listens
+  }
+  CheckBudget("EmitTargeted", scope.Count(), 2 * kEmits, 0);
+  Check(calls == kEmits + 1, "every EmitTargeted reached its handler");
+}
+
+// Tests that Enqueue of a small trivially copyable job only pays for queue block growth
+void TestEnqueue() {
+  std::cout << "\nTest 3: Enqueue\n";
+
+  constexpr int kJobs = 1024;
+  std::atomic<int> done{0};
+  {
+    ThreadPool pool(1);
+    AllocationScope scope;
+    for (int i = 0; i < kJobs; ++i) {
+      pool.Enqueue([counter = &done]() { counter->fetch_add(1, std::memory_order_relaxed); });
+    }
+    const uint64_t budget = kJobs / 8;  // std::queue block refills, never a per-job allocation
+    CheckBudget("Enqueue", scope.Count(), kJobs, budget);
+  }
+  Check(done == kJobs, "every enqueued job ran");
+}
+
+// Tests the cost of building a Then chain and of running it on the worker
+void TestThenChain() {
+  std::cout << "\nTest 4: Then Chain\n";
+
+  constexpr int kLinks = 256;
+  ThreadPool pool(1);  // single worker, so its counters see the whole run
+
+  uint64_t worker_start = 0;
+  uint64_t worker_end = 0;
+
+  AllocationScope build_scope;
+  auto head = std::make_shared<Task<void>>([&worker_start]() { worker_start = t_allocation_count; });
+  auto tail = head;
+  for (int i = 0; i < kLinks; ++i) {
+    tail = tail->Then(std::make_shared<Task<void>>([]() {}));
+  }
+  tail = tail->Then(std::make_shared<Task<void>>([&worker_end]() { worker_end = t_allocation_count; }));
+  const uint64_t build_allocations = build_scope.Count();
+  const uint64_t build_budget = 2 * (kLinks + 2);  // the task block and its predecessor's successor vector
+  CheckBudget("Then chain build", build_allocations, kLinks + 2, build_budget);
+
+  head->TrySchedule(pool);
+  tail->Wait();
+
+  const uint64_t run_allocations = worker_end - worker_start;
+  const uint64_t run_budget = kLinks / 8;  // queue block refills only
+  CheckBudget("Then chain run (worker)", run_allocations, kLinks + 2, run_budget);
+}
+
+// A real coroutine suspended on task; the awaiter is named so no temporary lives across the suspension
+CoroTask<void> AwaitOnce(std::shared_ptr<Task<void>> task, ThreadPool& pool) {
+  TaskAwaiter<void> awaiter{task, pool};
+  co_await awaiter;
+}
+
+// Tests TaskAwaiter: free when the task is done; a suspending coroutine pays for its frame and one resumption task,
+// and resuming it on the worker allocates nothing beyond queue growth
+void TestTaskAwaiter() {
+  std::cout << "\nTest 5: TaskAwaiter\n";
+
+  ThreadPool pool(1);
+
+  auto done_task = std::make_shared<Task<void>>([]() {});
+  done_task->TrySchedule(pool);
+  done_task->Wait();
+  {
+    AllocationScope scope;
+    TaskAwaiter<void> awaiter{done_task, pool};
+    Check(awaiter.await_ready(), "a finished task is ready without suspending");
+    awaiter.await_resume();
+    CheckBudget("co_await (ready)", scope.Count(), 1, 0);
+  }
+
+  constexpr int kAwaits = 64;
+  std::vector<std::shared_ptr<Task<void>>> pending;
+  for (int i = 0; i < kAwaits; ++i) {
+    pending.push_back(std::make_shared<Task<void>>([]() {}));
+  }
+  std::vector<CoroTask<void>> coroutines;
+  coroutines.reserve(kAwaits);
+
+  // The single worker samples its own counter before and after, so the resumption side is measured too
+  uint64_t worker_start = 0;
+  uint64_t worker_end = 0;
+  auto sample_start = std::make_shared<Task<void>>([&worker_start]() { worker_start = t_allocation_count; });
+  sample_start->TrySchedule(pool);
+  sample_start->Wait();
+
+  AllocationScope scope;
+  for (auto& task : pending) {
+    coroutines.push_back(AwaitOnce(task, pool));
+  }
+  const uint64_t suspend_allocations = scope.Count();
+  for (auto& coroutine : coroutines) {
+    coroutine.Wait();
+  }
+
+  auto sample_end = std::make_shared<Task<void>>([&worker_end]() { worker_end = t_allocation_count; });
+  sample_end->TrySchedule(pool);
+  sample_end->Wait();
+
+  const uint64_t suspend_budget = 4 * kAwaits;  // coroutine frame, resumption task, successor vector, queue block refills
+  CheckBudget("co_await (suspend)", suspend_allocations, kAwaits, suspend_budget);
+  const uint64_t resume_budget = kAwaits / 4;  // queue block refills only
+  CheckBudget("co_await (resume, worker)", worker_end - worker_start, kAwaits, resume_budget);
+}
+
+bool RunAll() {
+  std::cout << "\n=== Allocation Budget Tests ===\n";
+  TestEmit();
+  TestEmitTargeted();
+  TestEnqueue();
+  TestThenChain();
+  TestTaskAwaiter();
+  std::cout << (g_failed ? "\nAllocation Budget tests FAILED\n" : "\nAll Allocation Budget tests passed!\n");
+  return !g_failed;
+}
+
+}  // namespace AllocationBudgetDemo
+
+int main() {
+  return AllocationBudgetDemo::RunAll() ? 0 : 1;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file CancellableAwaitDemo.cpp
+ * @brief Demonstrates co_await WithToken(task, token, pool): coroutines that stop waiting when their token fires.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "CancellationToken.hpp"
+#include "CoroTask.hpp"
+#include "EventScope.hpp"
+#include "Task.hpp"
+#include "TaskAwaiter.hpp"
+#include "ThreadPool.hpp"
+
+namespace CancellableAwaitDemo {
+
+using namespace std::chrono_literals;
+
+// Task that blocks a worker until released, standing in for a long load
+std::shared_ptr<Task<int>> MakeGatedTask(std::atomic<bool>& release, int value) {
+  return std::make_shared<Task<int>>([&release, value]() {
+    while (!release) {
+      std::this_thread::sleep_for(1ms);
+    }
+    return value;
+  });
+}
+
+CoroTask<void> AwaitValue(std::shared_ptr<Task<int>> task, CancellationTokenPtr token, ThreadPool& pool,
+                          std::atomic<int>& sum, std::atomic<int>& cancelled) {
+  try {
+    sum += co_await WithToken(task, token, pool);
+  } catch (const TaskCancelledException&) {
+    cancelled++;
+  }
+}
+
+// Tests that callbacks can be unregistered before Cancel, and that RegisterCallback on a cancelled token runs inline
+void TestUnregisterCallback() {
+  std::cout << "\nTest 1: Unregister Callback\n";
+
+  auto token = MakeCancellationToken();
+  int calls = 0;
+  auto dropped = token->RegisterCallback([&calls]() { calls += 100; });
+  auto kept = token->RegisterCallback([&calls]() { calls++; });
+  assert(dropped != kept && dropped != CancellationToken::kNoCallback);
+  assert(token->UnregisterCallback(dropped));
+  assert(!token->UnregisterCallback(dropped));
+
+  token->Cancel();
+  assert(calls == 1);
+  assert(!token->UnregisterCallback(kept));  // already taken by Cancel
+  assert(token->RegisterCallback([&calls]() { calls++; }) == CancellationToken::kNoCallback && calls == 2);
+  std::cout << "  PASS\n";
+}
+
+// Tests that a normally completing await returns the result and unregisters its callback, so a later Cancel is a no-op
+void TestCompletion() {
+  std::cout << "\nTest 2: Normal Completion\n";
+
+  constexpr int kAwaits = 200;
+  ThreadPool pool(2);
+  auto token = MakeCancellationToken();
+  std::atomic<int> sum{0};
+  std::atomic<int> cancelled{0};
+  for (int i = 0; i < kAwaits; ++i) {
+    auto task = std::make_shared<Task<int>>([]() { return 1; });
+    auto coro = AwaitValue(task, token, pool, sum, cancelled);
+    coro.Wait();
+  }
+  assert(sum == kAwaits && cancelled == 0);
+
+  // Cancelling after the awaits completed runs the probe and resumes nothing a second time
+  int calls = 0;
+  token->RegisterCallback([&calls]() { calls++; });
+  token->Cancel();
+  pool.Shutdown();
+  assert(calls == 1 && sum == kAwaits && cancelled == 0);
+  std::cout << "  " << kAwaits << " awaits completed; a later Cancel resumed none of them\n";
+  std::cout << "  PASS\n";
+}
+
+// Tests that cancelling resumes a suspended coroutine right away while the task is still running
+void TestCancelWhileSuspended() {
+  std::cout << "\nTest 3: Cancel While Suspended\n";
+
+  ThreadPool pool(2);
+  std::atomic<bool> release{false};
+  auto token = MakeCancellationToken();
+  auto task = MakeGatedTask(release, 7);
+  std::atomic<int> sum{0};
+  std::atomic<int> cancelled{0};
+
+  auto coro = AwaitValue(task, token, pool, sum, cancelled);
+  std::this_thread::sleep_for(10ms);
+  auto start = std::chrono::steady_clock::now();
+  token->Cancel();
+  coro.Wait();
+  auto waited = std::chrono::steady_clock::now() - start;
+
+  std::cout << "  resumed " << std::chrono::duration<double, std::milli>(waited).count() << " ms after Cancel\n";
+  assert(cancelled == 1 && sum == 0 && !task->IsDone());
+
+  // The task finishing later must not resume the coroutine a second time
+  release = true;
+  task->Wait();
+  pool.Shutdown();
+  assert(task->Result() == 7 && cancelled == 1 && sum == 0);
+
+  // An already-cancelled token does not suspend at all
+  std::atomic<bool> never{false};
+  ThreadPool idle_pool(1);
+  auto unstarted = MakeGatedTask(never, 1);
+  auto early = AwaitValue(unstarted, token, idle_pool, sum, cancelled);
+  early.Wait();
+  assert(cancelled == 2);
+  std::cout << "  PASS\n";
+}
+
+// A subsystem whose coroutines wait on loads; destroying its EventScope must end all of them promptly
+struct StreamingSubsystem {
+  std::unique_ptr<EventScope> scope = std::make_unique<EventScope>();
+  std::vector<CoroTask<void>> loads;
+};
+
+CoroTask<void> StreamChunk(std::shared_ptr<Task<int>> load, CancellationTokenPtr token, ThreadPool& pool,
+                           std::atomic<int>& exited) {
+  struct ExitProbe {
+    std::atomic<int>& exited;
+    ~ExitProbe() {
+      exited++;
+    }
+  } probe{exited};
+
+  int bytes = co_await WithToken(load, token, pool);
+  (void)bytes;
+}
+
+// Tests that cancelling an EventScope's token ends the coroutines awaiting through it, so their frames can be freed
+void TestScopeTeardown() {
+  std::cout << "\nTest 4: Scope Teardown Releases Coroutines\n";
+
+  constexpr int kChunks = 32;
+  ThreadPool pool(2);
+  std::atomic<bool> release{false};
+  auto load = MakeGatedTask(release, 4096);
+  std::atomic<int> exited{0};
+
+  StreamingSubsystem subsystem;
+  for (int i = 0; i < kChunks; ++i) {
+    subsystem.loads.push_back(StreamChunk(load, subsystem.scope->GetToken(), pool, exited));
+  }
+  std::this_thread::sleep_for(10ms);
+  assert(exited == 0);
+
+  subsystem.scope.reset();  // cancels the scope token
+  for (auto& coro : subsystem.loads) {
+    coro.Wait();
+  }
+  assert(exited == kChunks && !load->IsDone());
+  subsystem.loads.clear();  // frames destroyed while the load is still running
+
+  release = true;
+  load->Wait();
+  std::cout << "  " << kChunks << " coroutines ended before their load finished\n";
+  std::cout << "  PASS\n";
+}
+
+// Tests Cancel racing task completion: each coroutine resumes exactly once, by whichever side wins
+void TestCancelRace() {
+  std::cout << "\nTest 5: Cancel Racing Completion\n";
+
+  constexpr int kRounds = 500;
+  ThreadPool pool(2);
+  std::atomic<int> sum{0};
+  std::atomic<int> cancelled{0};
+  for (int round = 0; round < kRounds; ++round) {
+    auto token = MakeCancellationToken();
+    auto task = std::make_shared<Task<int>>([]() { return 1; });
+    auto coro = AwaitValue(task, token, pool, sum, cancelled);
+    std::thread canceller([&token]() { token->Cancel(); });
+    coro.Wait();
+    canceller.join();
+    task->Wait();
+  }
+  std::cout << "  " << sum << " completed, " << cancelled << " cancelled\n";
+  assert(sum + cancelled == kRounds);
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== Cancellable Await Tests ===\n";
+  TestUnregisterCallback();
+  TestCompletion();
+  TestCancelWhileSuspended();
+  TestScopeTeardown();
+  TestCancelRace();
+  std::cout << "\nAll Cancellable Await tests passed!\n";
+}
+
+}  // namespace CancellableAwaitDemo
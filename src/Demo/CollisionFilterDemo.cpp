@@ -4,14 +4,18 @@
  * @details Shows separation of concerns: EventBus handles routing,
  *          Physics System handles emission filtering,
  *          Components handle reception filtering.
+ *          The contact-frame tests filter a whole frame with CollisionMatrix::FilterBatch and deliver it with
+ *          EventBus::EmitTargetedBatch.
  */
 
-#include <array>
 #include <cassert>
+#include <chrono>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <vector>
 
+#include "CollisionMatrix.hpp"
 #include "EventBus.hpp"
 #include "Events.hpp"
 #include "SubjectID.hpp"
@@ -19,23 +23,25 @@
 
 namespace CollisionFilterDemo {
 
-class CollisionMatrix {
- public:
-  void SetFilter(EntityCategory a, EntityCategory b, bool enabled) {
-    size_t idx_a = static_cast<size_t>(a);
-    size_t idx_b = static_cast<size_t>(b);
-    matrix_[idx_a][idx_b] = enabled;
+// Contacts of one physics step, stored as parallel arrays so the categories can be filtered in bulk
+struct ContactFrame {
+  std::vector<uint64_t> entity_a;
+  std::vector<uint64_t> entity_b;
+  std::vector<EntityCategory> category_a;
+  std::vector<EntityCategory> category_b;
+  std::vector<float> force;
+
+  void Add(uint64_t a, uint64_t b, EntityCategory cat_a, EntityCategory cat_b, float f) {
+    entity_a.push_back(a);
+    entity_b.push_back(b);
+    category_a.push_back(cat_a);
+    category_b.push_back(cat_b);
+    force.push_back(f);
   }
 
-  bool ShouldCollide(EntityCategory a, EntityCategory b) const {
-    size_t idx_a = static_cast<size_t>(a);
-    size_t idx_b = static_cast<size_t>(b);
-    return matrix_[idx_a][idx_b];
+  size_t Size() const {
+    return entity_a.size();
   }
-
- private:
-  static constexpr size_t kCategoryCount = static_cast<size_t>(EntityCategory::COUNT);
-  std::array<std::array<bool, kCategoryCount>, kCategoryCount> matrix_{};
 };
 
 // Physics System - Responsible for filtering at emission
@@ -44,6 +50,32 @@ class PhysicsSystem {
   PhysicsSystem(std::shared_ptr<EventBus> bus, const CollisionMatrix& matrix) : bus_(bus), collision_matrix_(matrix) {
   }
 
+  // Filters the whole frame at once, then emits both sides of every passing contact in one batch
+  size_t EmitContacts(const ContactFrame& frame) {
+    passing_.resize(frame.Size());
+    size_t count = collision_matrix_.FilterBatch(std::span(frame.category_a), std::span(frame.category_b), std::span(passing_));
+
+    events_.clear();
+    targets_.clear();
+    for (size_t k = 0; k < count; ++k) {
+      uint32_t i = passing_[k];
+      events_.push_back(CollisionEvent{.entity_a_id = frame.entity_a[i],
+                                       .entity_b_id = frame.entity_b[i],
+                                       .category_a = frame.category_a[i],
+                                       .category_b = frame.category_b[i],
+                                       .force = frame.force[i]});
+      targets_.push_back(SubjectID(frame.entity_a[i]));
+      events_.push_back(CollisionEvent{.entity_a_id = frame.entity_b[i],
+                                       .entity_b_id = frame.entity_a[i],
+                                       .category_a = frame.category_b[i],
+                                       .category_b = frame.category_a[i],
+                                       .force = frame.force[i]});
+      targets_.push_back(SubjectID(frame.entity_b[i]));
+    }
+    bus_->EmitTargetedBatch(std::span<const CollisionEvent>(events_), std::span<const SubjectID>(targets_));
+    return count;
+  }
+
   // Filter at source: only emit when collision matrix allows
   void EmitCollision(uint64_t entity_a, uint64_t entity_b, EntityCategory cat_a, EntityCategory cat_b, float force) {
     if (!collision_matrix_.ShouldCollide(cat_a, cat_b)) {
@@ -64,6 +96,10 @@ class PhysicsSystem {
  private:
   std::shared_ptr<EventBus> bus_;
   const CollisionMatrix& collision_matrix_;
+  // Reused across frames so steady-state frames do not allocate
+  std::vector<uint32_t> passing_;
+  std::vector<CollisionEvent> events_;
+  std::vector<SubjectID> targets_;
 };
 
 // Component - Simple subscription, no filter (filtering done at source)
@@ -305,6 +341,172 @@ void TestEmptyTarget() {
   std::cout << "  PASS - No crash when emitting to non-existent target\n";
 }
 
+// Tests that FilterBatch agrees with ShouldCollide pair by pair, including ragged tails and out-of-range categories
+void TestBatchMatchesScalar() {
+  std::cout << "\nTest: Batch Filter Matches Per-Pair Filter\n";
+
+  std::mt19937 rng(73);
+  CollisionMatrix matrix;
+  for (uint8_t a = 0; a < CollisionMatrix::kMaxCategories; ++a) {
+    for (uint8_t b = 0; b < CollisionMatrix::kMaxCategories; ++b) {
+      matrix.SetFilter(a, b, rng() % 3 == 0);
+    }
+  }
+  matrix.SetFilter(uint8_t{15}, uint8_t{9}, true);
+  matrix.SetFilter(uint8_t{15}, uint8_t{9}, false);
+  assert(!matrix.ShouldCollide(uint8_t{15}, uint8_t{9}));
+
+  for (size_t count : {size_t{0}, size_t{1}, size_t{15}, size_t{16}, size_t{17}, size_t{1000}, size_t{4099}}) {
+    std::vector<uint8_t> a(count);
+    std::vector<uint8_t> b(count);
+    for (size_t i = 0; i < count; ++i) {
+      // Mostly valid categories, with some 16..31 and some >= 0x80, which pshufb treats differently
+      uint32_t r = rng();
+      a[i] = static_cast<uint8_t>(r % 8 == 0 ? r >> 8 : r % 16);
+      b[i] = static_cast<uint8_t>(r % 8 == 1 ? 16 + (r >> 8) % 16 : (r >> 12) % 16);
+    }
+    std::vector<uint32_t> expected;
+    for (size_t i = 0; i < count; ++i) {
+      if (matrix.ShouldCollide(a[i], b[i])) {
+        expected.push_back(static_cast<uint32_t>(i));
+      }
+    }
+    std::vector<uint32_t> passing(count);
+    size_t written = matrix.FilterBatch(std::span<const uint8_t>(a), std::span<const uint8_t>(b), std::span(passing));
+    passing.resize(written);
+    assert(passing == expected);
+  }
+  std::cout << "  PASS\n";
+}
+
+// Builds a frame of count random contacts between entities [0, entities)
+ContactFrame RandomFrame(size_t count, uint64_t entities, uint32_t seed) {
+  std::mt19937 rng(seed);
+  ContactFrame frame;
+  constexpr uint32_t kCategories = static_cast<uint32_t>(EntityCategory::COUNT);
+  for (size_t i = 0; i < count; ++i) {
+    frame.Add(rng() % entities, rng() % entities, static_cast<EntityCategory>(rng() % kCategories),
+              static_cast<EntityCategory>(rng() % kCategories), static_cast<float>(rng() % 100));
+  }
+  return frame;
+}
+
+CollisionMatrix GameplayMatrix() {
+  CollisionMatrix matrix;
+  for (auto other : {EntityCategory::Enemy, EntityCategory::Wall, EntityCategory::Projectile}) {
+    matrix.SetFilter(EntityCategory::Player, other, true);
+    matrix.SetFilter(other, EntityCategory::Player, true);
+  }
+  matrix.SetFilter(EntityCategory::Projectile, EntityCategory::Wall, true);
+  matrix.SetFilter(EntityCategory::Enemy, EntityCategory::Wall, true);
+  return matrix;
+}
+
+// Tests that a 50k-contact frame delivered with EmitContacts reaches the same handlers as per-contact EmitCollision
+void TestContactFrame() {
+  std::cout << "\nTest: 50k-Contact Frame (Batch Filter + Batch Emit)\n";
+
+  constexpr size_t kContacts = 50000;
+  constexpr uint64_t kEntities = 2000;
+  ThreadPool pool(2);
+  auto bus = std::make_shared<EventBus>(pool);
+  CollisionMatrix matrix = GameplayMatrix();
+  PhysicsSystem physics(bus, matrix);
+
+  std::vector<int> received(kEntities, 0);
+  double force_sum = 0.0;
+  std::vector<EventHandle> handles;
+  for (uint64_t id = 0; id < kEntities; ++id) {
+    handles.push_back(bus->SubscribeTargeted<CollisionEvent>(SubjectID(id), [&, id](const CollisionEvent& event) {
+      assert(event.entity_a_id == id);
+      received[id]++;
+      force_sum += event.force;
+    }));
+  }
+
+  ContactFrame frame = RandomFrame(kContacts, kEntities, 5);
+  size_t passing = physics.EmitContacts(frame);
+  auto batch_received = received;
+  double batch_force = force_sum;
+
+  std::fill(received.begin(), received.end(), 0);
+  force_sum = 0.0;
+  for (size_t i = 0; i < frame.Size(); ++i) {
+    physics.EmitCollision(frame.entity_a[i], frame.entity_b[i], frame.category_a[i], frame.category_b[i], frame.force[i]);
+  }
+
+  std::cout << "  " << passing << " of " << kContacts << " contacts passed the matrix\n";
+  assert(passing > 0 && passing < kContacts);
+  assert(batch_received == received && batch_force == force_sum);
+  std::cout << "  PASS\n";
+}
+
+// Times per-pair filtering and emission against FilterBatch and EmitTargetedBatch on a 50k-contact frame
+void TestBatchBenchmark() {
+  std::cout << "\nTest: Batch Filter Benchmark\n";
+
+  constexpr size_t kContacts = 50000;
+  constexpr int kFrames = 20;
+  ThreadPool pool(2);
+  auto bus = std::make_shared<EventBus>(pool);
+  CollisionMatrix matrix = GameplayMatrix();
+  PhysicsSystem physics(bus, matrix);
+  ContactFrame frame = RandomFrame(kContacts, 2000, 9);
+
+  int delivered = 0;
+  std::vector<EventHandle> handles;
+  for (uint64_t id = 0; id < 2000; ++id) {
+    handles.push_back(bus->SubscribeTargeted<CollisionEvent>(SubjectID(id), [&delivered](const CollisionEvent&) { delivered++; }));
+  }
+
+  auto time_ms = [](auto&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kFrames;
+  };
+
+  std::vector<uint32_t> passing(kContacts);
+  size_t branch_count = 0;
+  size_t batch_count = 0;
+  double branch_ms = time_ms([&]() {
+    for (int f = 0; f < kFrames; ++f) {
+      branch_count = 0;
+      for (size_t i = 0; i < kContacts; ++i) {
+        if (matrix.ShouldCollide(frame.category_a[i], frame.category_b[i])) {
+          passing[branch_count++] = static_cast<uint32_t>(i);
+        }
+      }
+    }
+  });
+  double batch_ms = time_ms([&]() {
+    for (int f = 0; f < kFrames; ++f) {
+      batch_count = matrix.FilterBatch(std::span(frame.category_a), std::span(frame.category_b), std::span(passing));
+    }
+  });
+  assert(branch_count == batch_count);
+
+  double emit_each_ms = time_ms([&]() {
+    for (int f = 0; f < kFrames; ++f) {
+      for (size_t i = 0; i < kContacts; ++i) {
+        physics.EmitCollision(frame.entity_a[i], frame.entity_b[i], frame.category_a[i], frame.category_b[i], frame.force[i]);
+      }
+    }
+  });
+  int per_contact_delivered = delivered;
+  delivered = 0;
+  double emit_batch_ms = time_ms([&]() {
+    for (int f = 0; f < kFrames; ++f) {
+      physics.EmitContacts(frame);
+    }
+  });
+  assert(delivered == per_contact_delivered);
+
+  std::cout << "  filter " << kContacts << " contacts: per-pair branch " << branch_ms << " ms, FilterBatch " << batch_ms
+            << " ms per frame\n";
+  std::cout << "  filter + emit: per contact " << emit_each_ms << " ms, EmitContacts " << emit_batch_ms << " ms per frame\n";
+  std::cout << "  PASS\n";
+}
+
 void RunAll() {
   std::cout << "\n=== Collision Filtering Tests (Simplified API) ===\n";
   TestTargetedDispatch();
@@ -313,6 +515,9 @@ void RunAll() {
   TestPerformanceComparison();
   TestUnsubscribeTargeted();
   TestEmptyTarget();
+  TestBatchMatchesScalar();
+  TestContactFrame();
+  TestBatchBenchmark();
   std::cout << "\nAll Collision Filtering tests passed!\n";
   std::cout << "\nKey Design Principles:\n";
   std::cout << "  - EventBus: Simple routing (O(1) targeted dispatch)\n";
@@ -0,0 +1,167 @@
+/**
+ * @file DeadlineDemo.cpp
+ * @brief Demonstrates deadline-aware scheduling: the earliest-deadline-first lane and the late-task policies.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Task.hpp"
+#include "ThreadPool.hpp"
+
+namespace DeadlineDemo {
+
+using namespace std::chrono_literals;
+
+// Tests that queued deadline work runs earliest deadline first and ahead of plain FIFO work
+void TestEarliestDeadlineFirst() {
+  std::cout << "\nTest 1: Earliest Deadline First\n";
+
+  ThreadPool pool(1);
+  std::mutex order_mutex;
+  std::vector<int> order;
+  auto record = [&](int id) {
+    std::lock_guard<std::mutex> lock(order_mutex);
+    order.push_back(id);
+  };
+
+  // Hold the only worker so everything below queues up before anything runs
+  std::atomic<bool> release{false};
+  pool.Enqueue([&]() {
+    while (!release) {
+      std::this_thread::yield();
+    }
+  });
+
+  auto now = ThreadPool::Clock::now();
+  pool.Enqueue([&]() { record(0); });  // FIFO work, submitted first
+  std::vector<std::shared_ptr<Task<void>>> tasks;
+  for (int id : {3, 1, 2}) {
+    auto task = std::make_shared<Task<void>>([&record, id]() { record(id); });
+    task->SetDeadline(now + id * 1s);
+    task->TrySchedule(pool);
+    tasks.push_back(task);
+  }
+
+  release = true;
+  for (auto& task : tasks) {
+    task->Wait();
+  }
+  auto fifo_done = std::make_shared<Task<void>>([]() {});
+  pool.Enqueue([&]() { fifo_done->TrySchedule(pool); });  // queued behind the FIFO record
+  fifo_done->Wait();
+
+  assert((order == std::vector<int>{1, 2, 3, 0}));
+  auto metrics = pool.GetDeadlineMetrics();
+  std::cout << "  Order: 1 2 3 then FIFO; met " << metrics.met << ", missed " << metrics.missed << "\n";
+  assert(metrics.met == 3 && metrics.missed == 0);
+  std::cout << "  PASS\n";
+}
+
+// Tests that a CancelIfLate task is skipped once its deadline passed, failing its Then chain but not Finally
+void TestCancelIfLate() {
+  std::cout << "\nTest 2: Cancel If Late\n";
+
+  ThreadPool pool(1);
+  std::atomic<bool> ran{false};
+  std::atomic<bool> then_ran{false};
+  std::atomic<bool> finally_ran{false};
+
+  auto late = std::make_shared<Task<int>>([&]() {
+    ran = true;
+    return 42;
+  });
+  late->SetDeadline(ThreadPool::Clock::now() - 1ms, DeadlinePolicy::CancelIfLate);
+  late->Then(std::make_shared<Task<void>>([&]() { then_ran = true; }));
+  auto cleanup = late->Finally(std::make_shared<Task<void>>([&]() { finally_ran = true; }));
+
+  late->TrySchedule(pool);
+  cleanup->Wait();
+
+  bool threw = false;
+  try {
+    late->GetResult();
+  } catch (const DeadlineExceededException&) {
+    threw = true;
+  }
+
+  auto metrics = pool.GetDeadlineMetrics();
+  std::cout << "  ran: " << ran << ", then: " << then_ran << ", finally: " << finally_ran << ", dropped: " << metrics.dropped << "\n";
+  assert(threw && !ran && !then_ran && finally_ran);
+  assert(metrics.dropped == 1 && metrics.missed == 1);
+  std::cout << "  PASS\n";
+}
+
+// Tests that the default RunLate policy still runs a late task and counts the miss
+void TestRunLate() {
+  std::cout << "\nTest 3: Run Late\n";
+
+  ThreadPool pool(1);
+  auto late = std::make_shared<Task<int>>([]() { return 7; });
+  late->SetDeadline(ThreadPool::Clock::now() - 1ms);
+  late->TrySchedule(pool);
+  late->Wait();
+
+  assert(late->GetResult() == 7);
+  // The worker records the miss after the job returns, which may be just after Wait wakes up
+  while (pool.GetDeadlineMetrics().missed == 0) {
+    std::this_thread::yield();
+  }
+  auto metrics = pool.GetDeadlineMetrics();
+  assert(metrics.missed == 1 && metrics.dropped == 0 && metrics.met == 0);
+  std::cout << "  PASS\n";
+}
+
+// Shows a frame-paced burst: more 2 ms frame jobs than fit before their deadlines, so late ones are dropped
+void TestFrameBurst() {
+  std::cout << "\nTest 4: Frame Burst\n";
+
+  constexpr int kFrames = 60;
+  ThreadPool pool(2);
+  std::atomic<int> rendered{0};
+
+  auto start = ThreadPool::Clock::now();
+  std::vector<std::shared_ptr<Task<void>>> frames;
+  for (int i = 0; i < kFrames; ++i) {
+    auto frame = std::make_shared<Task<void>>([&]() {
+      std::this_thread::sleep_for(2ms);
+      rendered++;
+    });
+    frame->SetDeadline(start + (i % 4) * 1ms, DeadlinePolicy::CancelIfLate);
+    frame->TrySchedule(pool);
+    frames.push_back(frame);
+  }
+  for (auto& frame : frames) {
+    frame->Wait();
+  }
+
+  while (true) {
+    auto metrics = pool.GetDeadlineMetrics();
+    if (metrics.met + metrics.missed == kFrames) {
+      std::cout << "  rendered " << rendered << ", met " << metrics.met << ", missed " << metrics.missed << " (dropped "
+                << metrics.dropped << ")\n";
+      assert(metrics.dropped + rendered == kFrames);
+      assert(metrics.dropped > 0);
+      break;
+    }
+    std::this_thread::yield();
+  }
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== Deadline Scheduling Tests ===\n";
+  TestEarliestDeadlineFirst();
+  TestCancelIfLate();
+  TestRunLate();
+  TestFrameBurst();
+  std::cout << "\nAll Deadline Scheduling tests passed!\n";
+}
+
+}  // namespace DeadlineDemo
@@ -0,0 +1,133 @@
+/**
+ * @file EventBatchDemo.cpp
+ * @brief Demonstrates deferred structure-of-arrays batch delivery for plain-data events.
+ */
+
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <span>
+
+#include "EventBatch.hpp"
+#include "EventBus.hpp"
+#include "Events.hpp"
+#include "ThreadPool.hpp"
+
+namespace EventBatchDemo {
+
+// Tests that deferred events arrive as columns on flush, and only then
+void TestBatchColumns() {
+  std::cout << "\nTest 1: Batch Columns\n";
+
+  ThreadPool pool(2);
+  auto bus = std::make_shared<EventBus>(pool);
+
+  size_t batch_size = 0;
+  float total_damage = 0.0f;
+  int id_sum = 0;
+
+  auto handle = bus->SubscribeBatch<PlayerDamagedEvent>([&](const EventBatch<PlayerDamagedEvent>& batch) {
+    std::span<const float> damage = batch.Column<&PlayerDamagedEvent::damage>();
+    std::span<const int> ids = batch.Column<&PlayerDamagedEvent::player_id>();
+    batch_size = batch.Size();
+    total_damage = std::accumulate(damage.begin(), damage.end(), 0.0f);
+    id_sum = std::accumulate(ids.begin(), ids.end(), 0);
+  });
+
+  for (int i = 1; i <= 4; ++i) {
+    bus->EmitDeferred(PlayerDamagedEvent{.player_id = i, .damage = 2.5f});
+  }
+
+  assert(batch_size == 0);  // nothing delivered before the flush
+  bus->FlushBatches();
+
+  std::cout << "  Batch size: " << batch_size << ", total damage: " << total_damage << ", id sum: " << id_sum << "\n";
+  assert(batch_size == 4);
+  assert(total_damage == 10.0f);
+  assert(id_sum == 10);
+
+  batch_size = 0;
+  bus->FlushBatches();  // empty batches are not delivered
+  assert(batch_size == 0);
+  std::cout << "  PASS\n";
+}
+
+// Tests a vectorisable per-frame pass over thousands of collisions
+void TestCollisionBatchThroughput() {
+  std::cout << "\nTest 2: Collision Batch Throughput\n";
+
+  ThreadPool pool(2);
+  auto bus = std::make_shared<EventBus>(pool);
+
+  constexpr int kEvents = 50000;
+  double max_force = 0.0;
+  size_t wall_hits = 0;
+
+  auto handle = bus->SubscribeBatch<CollisionEvent>([&](const EventBatch<CollisionEvent>& batch) {
+    std::span<const float> force = batch.Column<&CollisionEvent::force>();
+    std::span<const EntityCategory> category_b = batch.Column<&CollisionEvent::category_b>();
+
+    float local_max = 0.0f;
+    for (float f : force) {
+      local_max = f > local_max ? f : local_max;
+    }
+    size_t walls = 0;
+    for (EntityCategory category : category_b) {
+      walls += category == EntityCategory::Wall ? 1 : 0;
+    }
+    max_force = local_max;
+    wall_hits = walls;
+  });
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kEvents; ++i) {
+    bus->EmitDeferred(CollisionEvent{.entity_a_id = static_cast<uint64_t>(i),
+      .entity_b_id = static_cast<uint64_t>(i + 1),
+      .category_a = EntityCategory::Player,
+      .category_b = (i % 2 == 0) ? EntityCategory::Wall : EntityCategory::Enemy,
+      .force = static_cast<float>(i % 100)});
+  }
+  bus->FlushBatches();
+  auto elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "  " << kEvents << " deferred collisions flushed in " << elapsed_ms << " ms\n";
+  std::cout << "  Max force: " << max_force << ", wall hits: " << wall_hits << "\n";
+  assert(max_force == 99.0);
+  assert(wall_hits == kEvents / 2);
+  std::cout << "  PASS\n";
+}
+
+// Tests that an unsubscribed batch handler no longer receives batches
+void TestBatchUnsubscribe() {
+  std::cout << "\nTest 3: Batch Unsubscribe\n";
+
+  ThreadPool pool(2);
+  auto bus = std::make_shared<EventBus>(pool);
+
+  int deliveries = 0;
+  {
+    auto handle = bus->SubscribeBatch<PlayerDamagedEvent>([&](const EventBatch<PlayerDamagedEvent>&) { deliveries++; });
+    bus->EmitDeferred(PlayerDamagedEvent{.player_id = 1, .damage = 1.0f});
+    bus->FlushBatches();
+  }
+
+  bus->EmitDeferred(PlayerDamagedEvent{.player_id = 1, .damage = 1.0f});
+  bus->FlushBatches();
+
+  std::cout << "  Deliveries: " << deliveries << " (expected: 1)\n";
+  assert(deliveries == 1);
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== Event Batch Tests ===\n";
+  TestBatchColumns();
+  TestCollisionBatchThroughput();
+  TestBatchUnsubscribe();
+  std::cout << "\nAll Event Batch tests passed!\n";
+}
+
+}  // namespace EventBatchDemo
@@ -0,0 +1,215 @@
+/**
+ * @file EventBridgeDemo.cpp
+ * @brief Demonstrates bridging two EventBus instances over a shared-memory ring.
+ * @details The receiving side stands in for a tooling process: it maps the same named region through its own
+ *          SharedMemoryRegion::Open, so the only thing it shares with the sender is the shared memory itself.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EventBridge.hpp"
+#include "EventBus.hpp"
+#include "EventSerialization.hpp"
+#include "Events.hpp"
+#include "SharedMemory.hpp"
+#include "SpscRing.hpp"
+#include "ThreadPool.hpp"
+
+namespace EventBridgeDemo {
+
+// Tests that trivially copyable and schema-described events round-trip through their byte form
+void TestSerializationRoundTrip() {
+  std::cout << "\nTest 1: Serialization Round Trip\n";
+
+  std::vector<std::byte> bytes;
+  SerializeEvent(PlayerDamagedEvent{.player_id = 7, .damage = 12.5f}, bytes);
+  PlayerDamagedEvent damaged{};
+  assert(DeserializeEvent(bytes, damaged));
+  assert(damaged.player_id == 7 && damaged.damage == 12.5f);
+
+  bytes.clear();
+  SerializeEvent(SceneLoadedEvent{.scene_name = "dungeon", .load_time_ms = 3.0f}, bytes);
+  SceneLoadedEvent scene{};
+  assert(DeserializeEvent(bytes, scene));
+  assert(scene.scene_name == "dungeon" && scene.load_time_ms == 3.0f);
+
+  bytes.pop_back();  // truncated payload is rejected rather than misread
+  assert(!DeserializeEvent(bytes, scene));
+
+  std::cout << "  PASS\n";
+}
+
+// Tests frame wrap-around and the full-ring / oversize rejections
+void TestRingWrapAround() {
+  std::cout << "\nTest 2: Ring Wrap Around\n";
+
+  std::vector<std::byte> memory(SpscRing::RequiredBytes(256));
+  SpscRing ring = SpscRing::Initialize(memory.data(), memory.size());
+
+  std::vector<std::byte> oversized(ring.MaxFrameSize() + 1);
+  assert(!ring.TryPush(oversized.data(), oversized.size()));
+
+  std::vector<std::byte> frame;
+  for (uint32_t i = 0; i < 1000; ++i) {
+    std::vector<std::byte> payload(1 + i % 37, static_cast<std::byte>(i));
+    assert(ring.TryPush(payload.data(), payload.size()));
+    assert(ring.TryPop(frame));
+    assert(frame == payload);
+  }
+  assert(ring.Empty());
+
+  std::vector<std::byte> filler(48);
+  int pushed = 0;
+  while (ring.TryPush(filler.data(), filler.size())) {
+    ++pushed;
+  }
+  assert(pushed > 0 && pushed * 56 <= 256);
+
+  std::cout << "  PASS\n";
+}
+
+// Tests a sender bus forwarding to a receiver bus through a named shared-memory region
+void TestCrossBusBridge() {
+  std::cout << "\nTest 3: Cross-Bus Bridge\n";
+
+  constexpr int kEvents = 20000;
+  const std::string name = "event_bridge_demo_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+  const size_t bytes = SpscRing::RequiredBytes(64 * 1024);
+
+  auto region = SharedMemoryRegion::Create(name, bytes);
+  EventBridgeSender sender(SpscRing::Initialize(region.Data(), region.Size()));
+
+  ThreadPool sim_pool(1);
+  auto sim_bus = std::make_shared<EventBus>(sim_pool);
+  sender.Forward<PlayerDamagedEvent>(*sim_bus);
+  sender.Forward<SceneLoadedEvent>(*sim_bus);
+
+  std::atomic<bool> ready{false};
+  std::atomic<bool> done{false};
+  int received_damage = 0;
+  std::string received_scene;
+
+  std::thread tooling([&]() {
+    auto view = SharedMemoryRegion::Open(name, bytes);
+    EventBridgeReceiver receiver(SpscRing::Attach(view.Data()));
+    receiver.Register<PlayerDamagedEvent>();
+    receiver.Register<SceneLoadedEvent>();
+
+    ThreadPool tools_pool(1);
+    auto tools_bus = std::make_shared<EventBus>(tools_pool);
+    auto damage_handle = tools_bus->Subscribe<PlayerDamagedEvent>([&](const PlayerDamagedEvent&) { ++received_damage; });
+    auto scene_handle = tools_bus->Subscribe<SceneLoadedEvent>([&](const SceneLoadedEvent& event) {
+      received_scene = event.scene_name;
+      done = true;
+    });
+
+    ready = true;
+    while (!done) {
+      if (receiver.Poll(*tools_bus) == 0) {
+        std::this_thread::yield();
+      }
+    }
+    assert(receiver.GetSkippedCount() == 0);
+  });
+
+  while (!ready) {
+    std::this_thread::yield();
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kEvents; ++i) {
+    sim_bus->Emit(PlayerDamagedEvent{.player_id = i, .damage = 1.0f});  // forwarded; dropped if the ring is full
+  }
+  const uint64_t dropped = sender.GetDroppedCount();
+  while (!sender.Send(SceneLoadedEvent{.scene_name = "arena", .load_time_ms = 2.0f})) {
+    std::this_thread::yield();  // the end marker must not be dropped
+  }
+  tooling.join();
+  double elapsed_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "  Bridged " << received_damage << " events (" << dropped << " dropped) in " << elapsed_us
+            << " us (" << elapsed_us / (received_damage + 1) << " us/event)\n";
+  assert(received_damage + dropped == kEvents);
+  assert(received_scene == "arena");
+  std::cout << "  PASS\n";
+}
+
+// Measures one-way latency of a single event with an idle ring (ping-pong over two regions)
+void TestPingPongLatency() {
+  std::cout << "\nTest 4: Ping-Pong Latency\n";
+
+  constexpr int kRoundTrips = 2000;
+  const std::string base = "event_bridge_latency_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+  const size_t bytes = SpscRing::RequiredBytes(4096);
+
+  auto ping_region = SharedMemoryRegion::Create(base + "_ping", bytes);
+  auto pong_region = SharedMemoryRegion::Create(base + "_pong", bytes);
+  EventBridgeSender ping_sender(SpscRing::Initialize(ping_region.Data(), ping_region.Size()));
+  EventBridgeReceiver pong_receiver(SpscRing::Initialize(pong_region.Data(), pong_region.Size()));
+  pong_receiver.Register<PlayerDamagedEvent>();
+
+  std::thread echo([&]() {
+    auto ping_view = SharedMemoryRegion::Open(base + "_ping", bytes);
+    auto pong_view = SharedMemoryRegion::Open(base + "_pong", bytes);
+    EventBridgeReceiver receiver(SpscRing::Attach(ping_view.Data()));
+    EventBridgeSender sender(SpscRing::Attach(pong_view.Data()));
+    receiver.Register<PlayerDamagedEvent>();
+
+    ThreadPool pool(1);
+    auto bus = std::make_shared<EventBus>(pool);
+    sender.Forward<PlayerDamagedEvent>(*bus);
+
+    int echoed = 0;
+    while (echoed < kRoundTrips) {
+      size_t polled = receiver.Poll(*bus);
+      if (polled == 0) {
+        std::this_thread::yield();
+      }
+      echoed += static_cast<int>(polled);
+    }
+  });
+
+  ThreadPool pool(1);
+  auto bus = std::make_shared<EventBus>(pool);
+  int replies = 0;
+  auto handle = bus->Subscribe<PlayerDamagedEvent>([&](const PlayerDamagedEvent&) { ++replies; });
+
+  std::vector<double> round_trips_us;
+  round_trips_us.reserve(kRoundTrips);
+  for (int i = 0; i < kRoundTrips; ++i) {
+    auto sent = std::chrono::steady_clock::now();
+    ping_sender.Send(PlayerDamagedEvent{.player_id = i, .damage = 0.0f});
+    while (pong_receiver.Poll(*bus) == 0) {
+      std::this_thread::yield();
+    }
+    round_trips_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - sent).count());
+  }
+  echo.join();
+
+  std::sort(round_trips_us.begin(), round_trips_us.end());
+  std::cout << "  One-way latency p50: " << round_trips_us[kRoundTrips / 2] / 2.0
+            << " us, p99: " << round_trips_us[kRoundTrips * 99 / 100] / 2.0 << " us\n";
+  assert(replies == kRoundTrips);
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== Event Bridge Tests ===\n";
+  TestSerializationRoundTrip();
+  TestRingWrapAround();
+  TestCrossBusBridge();
+  TestPingPongLatency();
+  std::cout << "\nAll Event Bridge tests passed!\n";
+}
+
+}  // namespace EventBridgeDemo
@@ -3,10 +3,13 @@
  * @brief Comprehensive test suite for EventBus functionality.
  */
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <iostream>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "CancellationToken.hpp"
 #include "Event.hpp"
@@ -50,6 +53,11 @@ struct EventB : Event<EventB> {
   int value;
 };
 
+struct TestParallelEvent : Event<TestParallelEvent> {
+  static constexpr std::string_view EventName = "test.parallel";
+  int iterations;
+};
+
 // Tests basic synchronous event emission with multiple subscribers
 // Shows: event dispatch, multiple handlers, call counting
 void TestBasicEmit() {
@@ -219,6 +227,88 @@ void TestMultipleEvents() {
   assert(event_b_count == 1);
 }
 
+// Tests fork-join parallel emit across many CPU-heavy handlers
+// Shows: every handler runs exactly once and EmitParallel returns only after all of them finished
+void TestEmitParallel() {
+  std::cout << "\nTest 8: EmitParallel Fork-Join\n";
+
+  ThreadPool pool(4);
+  auto bus = std::make_shared<EventBus>(pool);
+
+  constexpr int kHandlerCount = 200;
+  std::vector<int> per_handler(kHandlerCount, 0);
+  std::atomic<int> finished{0};
+
+  std::vector<EventHandle> handles;
+  for (int i = 0; i < kHandlerCount; ++i) {
+    handles.push_back(bus->Subscribe<TestParallelEvent>([&, i](const TestParallelEvent& event) {
+      volatile int sink = 0;
+      for (int n = 0; n < event.iterations; ++n) {
+        sink = sink + n;
+      }
+      per_handler[i]++;
+      finished++;
+    }));
+  }
+
+  bus->EmitParallel(TestParallelEvent{.iterations = 10000});
+
+  std::cout << "Handlers finished on return: " << finished << " (expected: " << kHandlerCount << ")\n";
+  assert(finished == kHandlerCount);
+  for (int count : per_handler) {
+    assert(count == 1);
+  }
+
+  bus->EmitParallel(TestParallelEvent{.iterations = 10}, 32);
+  assert(finished == 2 * kHandlerCount);
+}
+
+// Tests wildcard topic subscriptions resolved against EventName
+// Shows: "test.*" sees every single-segment test event, "#" sees everything, handles unsubscribe topics
+void TestWildcardTopics() {
+  std::cout << "\nTest 9: Wildcard Topics\n";
+
+  ThreadPool pool(2);
+  auto bus = std::make_shared<EventBus>(pool);
+
+  std::vector<std::string> test_topics;
+  int everything = 0;
+  int cancel_subtree = 0;
+  float damage_seen = 0.0f;
+
+  auto test_handle = bus->SubscribeTopic("test.*", [&](const TopicEvent& event) {
+    test_topics.emplace_back(event.name);
+    if (auto* damage = event.As<TestEvent>()) {
+      damage_seen += damage->damage;
+    }
+  });
+  auto all_handle = bus->SubscribeTopic("#", [&](const TopicEvent&) { everything++; });
+  auto subtree_handle = bus->SubscribeTopic("test.cancel.**", [&](const TopicEvent&) { cancel_subtree++; });
+
+  bus->Emit(TestEvent{.damage = 5.0f});
+  bus->Emit(TestCancelDuringEvent{.value = 1});  // "test.cancel.during": not one segment under test
+  bus->Emit(TestCancelEvent{.value = 1});        // "test.cancel": matches "test.cancel.**" with zero extra segments
+  bus->Emit(EventA{.value = 1});
+
+  std::cout << "test.*: " << test_topics.size() << ", #: " << everything << ", test.cancel.**: " << cancel_subtree << "\n";
+  assert((test_topics == std::vector<std::string>{"test.event", "test.cancel"}));
+  assert(damage_seen == 5.0f);
+  assert(everything == 4);
+  assert(cancel_subtree == 2);
+
+  // Typed and topic subscribers share one dispatch
+  std::atomic<int> async_topic{0};
+  auto async_handle = bus->SubscribeTopic("test.async", [&](const TopicEvent&) { async_topic++; });
+  auto task = bus->PublishAsync(TestAsyncEvent{.value = 1});
+  task->Wait();
+  assert(async_topic == 1);
+  assert(everything == 5);
+
+  all_handle.Unsubscribe();
+  bus->Emit(EventB{.value = 1});
+  assert(everything == 5);
+}
+
 // Runs all EventBus test suite
 // Shows: comprehensive validation of EventBus functionality
 void RunAll() {
@@ -230,6 +320,8 @@ void RunAll() {
   TestCancellationDuringEmit();
   TestHandleLifetime();
   TestMultipleEvents();
+  TestEmitParallel();
+  TestWildcardTopics();
   std::cout << "\nAll Event Bus tests passed!\n";
 }
 
@@ -0,0 +1,187 @@
+/**
+ * @file EventReplayDemo.cpp
+ * @brief Demonstrates recording emits into a binary log and replaying them through a fresh EventBus.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EventBus.hpp"
+#include "EventRecorder.hpp"
+#include "EventReplayer.hpp"
+#include "Events.hpp"
+#include "SubjectID.hpp"
+#include "ThreadPool.hpp"
+
+namespace EventReplayDemo {
+
+std::string LogPath() {
+  return (std::filesystem::temp_directory_path() / "event_replay_demo.evlog").string();
+}
+
+// Tests that a multi-threaded session replays with identical handler-visible results
+void TestRecordAndReplay() {
+  std::cout << "\nTest 1: Record and Replay\n";
+
+  constexpr int kThreads = 4;
+  constexpr int kEventsPerThread = 5000;
+
+  float recorded_damage = 0.0f;
+  {
+    ThreadPool pool(2);
+    auto bus = std::make_shared<EventBus>(pool);
+    auto recorder = std::make_shared<EventRecorder>(LogPath(), 4096);
+    bus->SetRecorder(recorder);
+
+    std::mutex damage_mutex;
+    auto handle = bus->Subscribe<PlayerDamagedEvent>([&](const PlayerDamagedEvent& event) {
+      std::lock_guard<std::mutex> lock(damage_mutex);
+      recorded_damage += event.damage;
+    });
+
+    std::vector<std::thread> emitters;
+    for (int t = 0; t < kThreads; ++t) {
+      emitters.emplace_back([&bus, t]() {
+        for (int i = 0; i < kEventsPerThread; ++i) {
+          bus->Emit(PlayerDamagedEvent{.player_id = t, .damage = 1.0f});
+          bus->EmitTargeted(CollisionEvent{.entity_a_id = static_cast<uint64_t>(t),
+                              .entity_b_id = static_cast<uint64_t>(i),
+                              .category_a = EntityCategory::Player,
+                              .category_b = EntityCategory::Wall,
+                              .force = 2.0f},
+            SubjectID(static_cast<uint64_t>(t)));
+        }
+      });
+    }
+    for (auto& emitter : emitters) {
+      emitter.join();
+    }
+
+    bus->Emit(SceneLoadedEvent{.scene_name = "forest", .load_time_ms = 1.0f});  // serialized through EventSchema
+    bool flushed = recorder->Flush();
+
+    std::cout << "  Recorded: " << recorder->GetRecordedCount() << ", skipped: " << recorder->GetSkippedCount()
+              << ", dropped: " << recorder->GetDroppedCount() << "\n";
+    assert(flushed && recorder->GetDroppedCount() == 0);
+    assert(recorder->GetRecordedCount() == 2 * kThreads * kEventsPerThread + 1);
+    assert(recorder->GetSkippedCount() == 0);
+  }
+
+  EventReplayer replayer(LogPath());
+  replayer.Register<PlayerDamagedEvent>();
+  replayer.Register<CollisionEvent>();
+  replayer.Register<SceneLoadedEvent>();
+
+  ThreadPool pool(2);
+  auto bus = std::make_shared<EventBus>(pool);
+  float replayed_damage = 0.0f;
+  std::vector<int> collisions_per_target(kThreads, 0);
+
+  std::string replayed_scene;
+
+  auto damage_handle = bus->Subscribe<PlayerDamagedEvent>([&](const PlayerDamagedEvent& event) { replayed_damage += event.damage; });
+  auto scene_handle = bus->Subscribe<SceneLoadedEvent>([&](const SceneLoadedEvent& event) { replayed_scene = event.scene_name; });
+  std::vector<EventHandle> collision_handles;
+  for (int t = 0; t < kThreads; ++t) {
+    collision_handles.push_back(bus->SubscribeTargeted<CollisionEvent>(
+      SubjectID(static_cast<uint64_t>(t)), [&collisions_per_target, t](const CollisionEvent&) { collisions_per_target[t]++; }));
+  }
+
+  auto stats = replayer.Replay(*bus);
+
+  std::cout << "  Replayed: " << stats.replayed << " in " << stats.elapsed_ms << " ms ("
+            << (stats.elapsed_ms > 0.0 ? stats.replayed / (stats.elapsed_ms / 1000.0) : 0.0) << " events/s)\n";
+  std::cout << "  Damage recorded: " << recorded_damage << ", replayed: " << replayed_damage << "\n";
+  assert(stats.replayed == replayer.GetRecordCount());
+  assert(stats.skipped == 0);
+  assert(replayed_damage == recorded_damage);
+  assert(replayed_scene == "forest");
+  for (int count : collisions_per_target) {
+    assert(count == kEventsPerThread);
+  }
+  std::cout << "  PASS\n";
+
+  std::filesystem::remove(LogPath());
+}
+
+// Tests that records of unregistered types are skipped rather than misdecoded
+void TestUnregisteredTypesSkipped() {
+  std::cout << "\nTest 2: Unregistered Types Skipped\n";
+
+  {
+    ThreadPool pool(1);
+    auto bus = std::make_shared<EventBus>(pool);
+    auto recorder = std::make_shared<EventRecorder>(LogPath());
+    bus->SetRecorder(recorder);
+    bus->Emit(PlayerDamagedEvent{.player_id = 1, .damage = 5.0f});
+    bus->EmitTargeted(CollisionEvent{.entity_a_id = 1,
+                        .entity_b_id = 2,
+                        .category_a = EntityCategory::Player,
+                        .category_b = EntityCategory::Enemy,
+                        .force = 1.0f},
+      SubjectID(1));
+  }  // recorder flushes on destruction
+
+  EventReplayer replayer(LogPath());
+  replayer.Register<PlayerDamagedEvent>();
+
+  ThreadPool pool(1);
+  auto bus = std::make_shared<EventBus>(pool);
+  auto stats = replayer.Replay(*bus);
+
+  std::cout << "  Replayed: " << stats.replayed << ", skipped: " << stats.skipped << "\n";
+  assert(stats.replayed == 1 && stats.skipped == 1);
+  std::cout << "  PASS\n";
+
+  std::filesystem::remove(LogPath());
+}
+
+// Tests that a log still being written grows past its first mapping and reads back only up to the last Flush
+void TestLiveLogGrowth() {
+  std::cout << "\nTest 3: Live Log Growth\n";
+
+  constexpr int kFlushedEvents = 50000;  // a few MB, well past the initial mapping
+  ThreadPool pool(1);
+  auto bus = std::make_shared<EventBus>(pool);
+  auto recorder = std::make_shared<EventRecorder>(LogPath(), 4096);
+  bus->SetRecorder(recorder);
+
+  for (int i = 0; i < kFlushedEvents; ++i) {
+    bus->Emit(PlayerDamagedEvent{.player_id = i, .damage = 1.0f});
+  }
+  bool flushed = recorder->Flush();
+  bus->Emit(PlayerDamagedEvent{.player_id = -1, .damage = 1.0f});  // buffered, not yet in the log
+
+  EventReplayer live(LogPath());
+  auto file_size = std::filesystem::file_size(LogPath());
+  std::cout << "  Records readable before close: " << live.GetRecordCount() << ", file size " << file_size << " bytes\n";
+  assert(flushed && recorder->GetDroppedCount() == 0);
+  assert(live.GetRecordCount() == kFlushedEvents);
+
+  bus->SetRecorder(nullptr);
+  recorder.reset();  // flushes the last record and trims the file to the records
+
+  EventReplayer closed(LogPath());
+  assert(closed.GetRecordCount() == kFlushedEvents + 1);
+  assert(std::filesystem::file_size(LogPath()) < file_size);
+  std::cout << "  PASS\n";
+
+  std::filesystem::remove(LogPath());
+}
+
+void RunAll() {
+  std::cout << "\n=== Event Record/Replay Tests ===\n";
+  TestRecordAndReplay();
+  TestUnregisteredTypesSkipped();
+  TestLiveLogGrowth();
+  std::cout << "\nAll Event Record/Replay tests passed!\n";
+}
+
+}  // namespace EventReplayDemo
@@ -1,6 +1,6 @@
 /**
  * @file EventScopeDemo.cpp
- * @brief UAF prevention test suite for EventScope with 7 critical edge cases.
+ * @brief UAF prevention test suite for EventScope with 8 critical edge cases.
  */
 
 #include <atomic>
@@ -278,13 +278,52 @@ void DemoTargetedCancellation() {
   }
 }
 
+// Tests that scope teardown defers handler removal to each bus instead of erasing under the bus lock.
+void DemoLazyTeardown() {
+  std::cout << "\n--- Demo 8: Lazy Teardown (Retired Handles Drained on Next Dispatch) ---\n";
+
+  ThreadPool local_pool(2);
+  auto local_bus = std::make_shared<EventBus>(local_pool);
+  auto other_bus = std::make_shared<EventBus>(local_pool);  // teardown groups handles per bus
+
+  constexpr int kSubscriptions = 1000;
+  auto captured = std::make_shared<int>(0);  // use_count tracks how many handlers the buses still hold
+  std::atomic<int> calls{0};
+
+  {
+    EventScope scope;
+    for (int i = 0; i < kSubscriptions; ++i) {
+      auto& bus = (i % 2 == 0) ? *local_bus : *other_bus;
+      scope.Subscribe<TestEvent>(bus, [captured, &calls](const TestEvent&) { calls++; });
+    }
+    local_bus->Emit(TestEvent{.damage = 1.0f});
+    other_bus->Emit(TestEvent{.damage = 1.0f});
+  }
+
+  long retained = captured.use_count() - 1;  // handler maps plus the cached dispatch snapshots
+  std::cout << "  Handlers still held by buses after teardown: " << retained << "\n";
+
+  local_bus->Emit(TestEvent{.damage = 1.0f});  // drains the retired list before snapshotting
+  long drained_local = captured.use_count() - 1;
+  other_bus->Emit(TestEvent{.damage = 1.0f});
+  long drained = captured.use_count() - 1;
+  std::cout << "  Handlers held after next emits: " << drained_local << " then " << drained << ", calls: " << calls
+            << "\n";
+
+  if (retained == 2 * kSubscriptions && drained_local == kSubscriptions && drained == 0 && calls == kSubscriptions) {
+    std::cout << "  ✓ PASS: Teardown was deferred and no retired handler ran\n";
+  } else {
+    std::cout << "  ✗ FAIL: Unexpected retire/drain behavior\n";
+  }
+}
+
 // ============================================================================
 // Main Demo Runner
 // ============================================================================
 /**
  * @brief Execute all EventScope UAF prevention demos.
  *
- * Runs 7 comprehensive edge case scenarios that test UAF prevention,
+ * Runs 8 comprehensive edge case scenarios that test UAF prevention,
  * reentrancy safety, concurrent access, and token lifetime management.
  */
 void RunAll() {
@@ -292,7 +331,7 @@ void RunAll() {
   std::cout << "╔════════════════════════════════════════════════════════╗\n";
   std::cout << "║     EventScope UAF Prevention Test Suite              ║\n";
   std::cout << "║                                                       ║\n";
-  std::cout << "║  7 Critical Edge Cases for Async Handler Safety       ║\n";
+  std::cout << "║  8 Critical Edge Cases for Async Handler Safety       ║\n";
   std::cout << "╚════════════════════════════════════════════════════════╝\n";
 
   DemoImmediateDestruction();
@@ -302,6 +341,7 @@ void RunAll() {
   DemoTokenLifetimeRace();
   DemoBusLifetime();
   DemoTargetedCancellation();
+  DemoLazyTeardown();
 
   std::cout << "\n";
   std::cout << "╔════════════════════════════════════════════════════════╗\n";
@@ -5,9 +5,12 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <tuple>
 
 #include "Event.hpp"
+#include "EventSerialization.hpp"
 
 struct PlayerDamagedEvent : Event<PlayerDamagedEvent> {
   static constexpr std::string_view EventName = "player.damaged";
@@ -23,8 +26,14 @@ struct ItemPickedUpEvent : Event<ItemPickedUpEvent> {
 
 struct SceneLoadedEvent : Event<SceneLoadedEvent> {
   static constexpr std::string_view EventName = "scene.loaded";
+  static constexpr bool Sticky = true;  // systems started after the load still see the current scene
   std::string scene_name;
   float load_time_ms;
+
+  // Loads of the same scene published in one frame are dispatched once (PublishAsyncSingleFlight)
+  const std::string& SingleFlightKey() const {
+    return scene_name;
+  }
 };
 
 enum class EntityCategory : uint8_t { Player, Enemy, Wall, Projectile, COUNT };
@@ -37,3 +46,39 @@ struct CollisionEvent : Event<CollisionEvent> {
   EntityCategory category_b;
   float force;
 };
+
+template <>
+struct BatchLayout<PlayerDamagedEvent> {
+  static constexpr auto Fields = std::make_tuple(&PlayerDamagedEvent::player_id, &PlayerDamagedEvent::damage);
+};
+
+template <>
+struct BatchLayout<CollisionEvent> {
+  static constexpr auto Fields = std::make_tuple(&CollisionEvent::entity_a_id,
+    &CollisionEvent::entity_b_id,
+    &CollisionEvent::category_a,
+    &CollisionEvent::category_b,
+    &CollisionEvent::force);
+};
+
+template <>
+struct EventSchema<ItemPickedUpEvent> {
+  static void Write(ByteWriter& writer, const ItemPickedUpEvent& event) {
+    writer.WritePod(event.item_id);
+    writer.WriteString(event.item_name);
+  }
+  static bool Read(ByteReader& reader, ItemPickedUpEvent& event) {
+    return reader.ReadPod(event.item_id) && reader.ReadString(event.item_name);
+  }
+};
+
+template <>
+struct EventSchema<SceneLoadedEvent> {
+  static void Write(ByteWriter& writer, const SceneLoadedEvent& event) {
+    writer.WriteString(event.scene_name);
+    writer.WritePod(event.load_time_ms);
+  }
+  static bool Read(ByteReader& reader, SceneLoadedEvent& event) {
+    return reader.ReadString(event.scene_name) && reader.ReadPod(event.load_time_ms);
+  }
+};
@@ -0,0 +1,93 @@
+/**
+ * @file FalseSharingBenchmark.cpp
+ * @brief Microbenchmark showing the cost of false sharing between hot atomics.
+ * @details Mirrors the TaskBase access pattern: writer threads hammer a fan-in counter (predecessor_count_)
+ *          while reader threads poll a completion flag (is_done_). The packed layout puts both on one cache
+ *          line, the padded layout uses kCacheLineSize like TaskBase, ThreadPool and CancellationToken.
+ * @note The delta only shows with at least two hardware threads; timings are printed, not asserted
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "CacheLine.hpp"
+
+namespace FalseSharingBenchmark {
+
+struct PackedState {
+  std::atomic<int64_t> predecessor_count{0};
+  std::atomic<bool> is_done{false};
+};
+
+struct PaddedState {
+  alignas(kCacheLineSize) std::atomic<int64_t> predecessor_count{0};
+  alignas(kCacheLineSize) std::atomic<bool> is_done{false};
+};
+
+constexpr int kIterations = 2'000'000;
+
+std::atomic<int64_t> g_sink{0};
+
+template <typename State>
+double Measure(int writers, int readers) {
+  State state;
+  std::atomic<bool> start{false};
+  std::vector<std::thread> threads;
+
+  for (int w = 0; w < writers; ++w) {
+    threads.emplace_back([&state, &start]() {
+      while (!start.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      for (int i = 0; i < kIterations; ++i) {
+        state.predecessor_count.fetch_add(1, std::memory_order_acq_rel);
+      }
+    });
+  }
+
+  for (int r = 0; r < readers; ++r) {
+    threads.emplace_back([&state, &start]() {
+      while (!start.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      int64_t observed = 0;
+      for (int i = 0; i < kIterations; ++i) {
+        observed += state.is_done.load(std::memory_order_acquire) ? 1 : 0;
+      }
+      g_sink.fetch_add(observed, std::memory_order_relaxed);  // keep the loads alive
+    });
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  start.store(true, std::memory_order_release);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+void RunAll() {
+  std::cout << "\n=== False Sharing Microbenchmark ===\n";
+  std::cout << "  sizeof(PackedState) = " << sizeof(PackedState) << ", sizeof(PaddedState) = " << sizeof(PaddedState) << "\n";
+  std::cout << "  Hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+  const int configs[][2] = {{1, 1}, {2, 2}, {3, 1}};
+  for (const auto& config : configs) {
+    int writers = config[0];
+    int readers = config[1];
+
+    double packed_ms = Measure<PackedState>(writers, readers);
+    double padded_ms = Measure<PaddedState>(writers, readers);
+
+    std::cout << "  writers=" << writers << " readers=" << readers << "  packed: " << packed_ms << " ms, padded: " << padded_ms
+              << " ms, speedup: " << (padded_ms > 0.0 ? packed_ms / padded_ms : 0.0) << "x\n";
+  }
+}
+
+}  // namespace FalseSharingBenchmark
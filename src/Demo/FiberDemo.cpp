@@ -0,0 +1,123 @@
+/**
+ * @file FiberDemo.cpp
+ * @brief Demonstrates blocking-style scripts running as fibers that park on Task::Wait instead of blocking workers.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Fiber.hpp"
+#include "Task.hpp"
+#include "ThreadPool.hpp"
+
+namespace FiberDemo {
+
+// Tests that a thousand scripts waiting on one task fit on two workers.
+// With thread-blocking Wait the first two scripts would hold both workers and the gate could never run.
+void TestThousandsOfWaiters() {
+  std::cout << "\nTest 1: Thousands Of Waiters\n";
+
+  constexpr int kScripts = 2000;
+  ThreadPool pool(2);
+  auto gate = std::make_shared<Task<void>>([]() {});
+  std::atomic<int> resumed{0};
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::shared_ptr<Task<void>>> scripts;
+  scripts.reserve(kScripts);
+  for (int i = 0; i < kScripts; ++i) {
+    scripts.push_back(Fiber::Spawn(pool, [&]() {
+      gate->Wait();
+      resumed++;
+    }));
+  }
+
+  gate->TrySchedule(pool);  // queued behind the scripts, so only parked fibers let it run
+  for (auto& script : scripts) {
+    script->Wait();
+  }
+  double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "  " << resumed << " scripts parked and resumed on " << pool.GetThreadCount() << " workers in " << elapsed_ms
+            << " ms\n";
+  assert(resumed == kScripts);
+  std::cout << "  PASS\n";
+}
+
+// Tests a script that waits on several results in sequence and may hop workers between them
+void TestSequentialScript() {
+  std::cout << "\nTest 2: Sequential Script\n";
+
+  ThreadPool pool(3);
+  int total = 0;
+  std::set<std::thread::id> threads_seen;
+
+  auto script = Fiber::Spawn(pool, [&]() {
+    for (int step = 1; step <= 5; ++step) {
+      threads_seen.insert(std::this_thread::get_id());
+      auto load = std::make_shared<Task<int>>([step]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        return step * 10;
+      });
+      load->TrySchedule(pool);
+      load->Wait();
+      total += load->GetResult();
+    }
+  });
+  script->Wait();
+
+  std::cout << "  total " << total << ", ran on " << threads_seen.size() << " worker thread(s)\n";
+  assert(total == 150);
+  std::cout << "  PASS\n";
+}
+
+// Tests that an exception thrown inside a fiber fails its completion task
+void TestExceptionPropagation() {
+  std::cout << "\nTest 3: Exception Propagation\n";
+
+  ThreadPool pool(1);
+  std::atomic<bool> then_ran{false};
+
+  auto script = Fiber::Spawn(pool, []() { throw std::runtime_error("script error"); });
+  script->Then(std::make_shared<Task<void>>([&]() { then_ran = true; }));
+  auto settled = script->Finally(std::make_shared<Task<void>>([]() {}));
+  settled->Wait();
+
+  assert(!then_ran);
+  std::cout << "  Then skipped after the fiber threw\n";
+  std::cout << "  PASS\n";
+}
+
+// Tests that Wait outside fibers still blocks the calling thread as before
+void TestWaitOutsideFiber() {
+  std::cout << "\nTest 4: Wait Outside Fiber\n";
+
+  ThreadPool pool(1);
+  assert(Fiber::Current() == nullptr);
+  auto task = std::make_shared<Task<int>>([]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    return 1;
+  });
+  task->TrySchedule(pool);
+  task->Wait();
+  assert(task->IsDone() && task->GetResult() == 1);
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== Fiber Tests ===\n";
+  TestThousandsOfWaiters();
+  TestSequentialScript();
+  TestExceptionPropagation();
+  TestWaitOutsideFiber();
+  std::cout << "\nAll Fiber tests passed!\n";
+}
+
+}  // namespace FiberDemo
@@ -0,0 +1,197 @@
+/**
+ * @file ParallelAlgorithmsDemo.cpp
+ * @brief Checks ParallelSort, ParallelInclusiveScan and ParallelTransform against the standard algorithms and times them.
+ * @details Timings compare the sequential algorithm, the task-system version and, when the build provides it
+ *          (TASKSYSTEM_HAS_STD_PARALLEL), the std::execution::par overload.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(TASKSYSTEM_HAS_STD_PARALLEL)
+#include <execution>
+#endif
+
+#include "ParallelAlgorithms.hpp"
+#include "ThreadPool.hpp"
+
+namespace ParallelAlgorithmsDemo {
+
+template <typename F>
+double TimeMs(F&& fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<uint32_t> RandomKeys(size_t count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::vector<uint32_t> keys(count);
+  for (auto& key : keys) {
+    key = rng();
+  }
+  return keys;
+}
+
+// Draw-list entry: sorted by key, payload checks that elements move as a whole
+struct DrawItem {
+  uint32_t key = 0;
+  std::string material;
+};
+
+// Tests sorting across sizes around the cutoff, with duplicates and non-trivial elements
+void TestSortCorrectness() {
+  std::cout << "\nTest 1: Sort Correctness\n";
+
+  ThreadPool pool(3);
+  for (size_t count : {size_t{0}, size_t{1}, size_t{1000}, kParallelAlgorithmCutoff * 2 + 7, size_t{300001}}) {
+    auto keys = RandomKeys(count, static_cast<uint32_t>(count));
+    for (size_t i = 0; i < keys.size(); i += 3) {
+      keys[i] %= 64;  // many duplicates
+    }
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+    ParallelSort(pool, keys.begin(), keys.end(), std::less<>{}, 1024);
+    assert(keys == expected);
+  }
+
+  std::vector<DrawItem> draws;
+  for (uint32_t key : RandomKeys(50000, 7)) {
+    draws.push_back(DrawItem{key % 1000, "m" + std::to_string(key % 1000)});
+  }
+  ParallelSort(pool, draws.begin(), draws.end(), [](const DrawItem& a, const DrawItem& b) { return a.key < b.key; }, 1024);
+  for (size_t i = 0; i < draws.size(); ++i) {
+    assert(draws[i].material == "m" + std::to_string(draws[i].key));
+    assert(i == 0 || draws[i - 1].key <= draws[i].key);
+  }
+  std::cout << "  PASS\n";
+}
+
+// Tests scans with a non-commutative associative op, in place and out of place
+void TestScanCorrectness() {
+  std::cout << "\nTest 2: Scan Correctness\n";
+
+  ThreadPool pool(3);
+  auto keys = RandomKeys(200003, 11);
+  std::vector<uint64_t> values(keys.begin(), keys.end());
+  std::vector<uint64_t> expected(values.size());
+  std::inclusive_scan(values.begin(), values.end(), expected.begin());
+  std::vector<uint64_t> scanned(values.size());
+  ParallelInclusiveScan(pool, values.begin(), values.end(), scanned.begin(), std::plus<>{}, 1024);
+  assert(scanned == expected);
+  ParallelInclusiveScan(pool, values.begin(), values.end(), values.begin(), std::plus<>{}, 1024);
+  assert(values == expected);
+
+  // Composition of affine maps x -> a*x + b (mod 2^64) is associative but not commutative
+  struct Affine {
+    uint64_t a = 1;
+    uint64_t b = 0;
+  };
+  auto compose = [](const Affine& first, const Affine& second) {
+    return Affine{second.a * first.a, second.a * first.b + second.b};
+  };
+  std::vector<Affine> maps(100000);
+  for (size_t i = 0; i < maps.size(); ++i) {
+    maps[i] = Affine{keys[i] | 1u, keys[i + 1]};
+  }
+  std::vector<Affine> affine_expected(maps.size());
+  std::vector<Affine> affine_scanned(maps.size());
+  std::inclusive_scan(maps.begin(), maps.end(), affine_expected.begin(), compose);
+  ParallelInclusiveScan(pool, maps.begin(), maps.end(), affine_scanned.begin(), compose, 1024);
+  for (size_t i = 0; i < maps.size(); ++i) {
+    assert(affine_scanned[i].a == affine_expected[i].a && affine_scanned[i].b == affine_expected[i].b);
+  }
+  std::cout << "  PASS\n";
+}
+
+// Tests transform results and that an exception from op reaches the caller
+void TestTransformCorrectness() {
+  std::cout << "\nTest 3: Transform Correctness\n";
+
+  ThreadPool pool(3);
+  std::vector<float> input(100000);
+  std::iota(input.begin(), input.end(), 0.0f);
+  std::vector<float> output(input.size());
+  auto end = ParallelTransform(pool, input.begin(), input.end(), output.begin(), [](float x) { return x * 2.0f + 1.0f; }, 1024);
+  assert(end == output.end());
+  for (size_t i = 0; i < input.size(); ++i) {
+    assert(output[i] == input[i] * 2.0f + 1.0f);
+  }
+
+  bool caught = false;
+  try {
+    ParallelTransform(pool, input.begin(), input.end(), output.begin(), [](float x) {
+      if (x == 77777.0f) {
+        throw std::runtime_error("bad component");
+      }
+      return x;
+    }, 1024);
+  } catch (const std::runtime_error&) {
+    caught = true;
+  }
+  assert(caught);
+  std::cout << "  PASS\n";
+}
+
+// Times the three algorithms against the sequential ones and std::execution::par
+void BenchmarkAgainstStandard() {
+  std::cout << "\nTest 4: Benchmark\n";
+
+  constexpr size_t kCount = 2'000'000;
+  ThreadPool pool;
+  std::cout << "  " << kCount << " elements, " << pool.GetThreadCount() << " pool workers + caller\n";
+
+  auto base = RandomKeys(kCount, 42);
+  auto keys = base;
+  double sort_seq = TimeMs([&]() { std::sort(keys.begin(), keys.end()); });
+  keys = base;
+  double sort_par = TimeMs([&]() { ParallelSort(pool, keys.begin(), keys.end()); });
+  assert(std::is_sorted(keys.begin(), keys.end()));
+
+  std::vector<uint64_t> values(base.begin(), base.end());
+  std::vector<uint64_t> out(kCount);
+  double scan_seq = TimeMs([&]() { std::inclusive_scan(values.begin(), values.end(), out.begin()); });
+  double scan_par = TimeMs([&]() { ParallelInclusiveScan(pool, values.begin(), values.end(), out.begin()); });
+
+  auto op = [](uint64_t x) { return x * 2654435761u ^ (x >> 7); };
+  double transform_seq = TimeMs([&]() { std::transform(values.begin(), values.end(), out.begin(), op); });
+  double transform_par = TimeMs([&]() { ParallelTransform(pool, values.begin(), values.end(), out.begin(), op); });
+
+  std::cout << "  sort:      std " << sort_seq << " ms, ParallelSort " << sort_par << " ms\n";
+  std::cout << "  scan:      std " << scan_seq << " ms, ParallelInclusiveScan " << scan_par << " ms\n";
+  std::cout << "  transform: std " << transform_seq << " ms, ParallelTransform " << transform_par << " ms\n";
+
+#if defined(TASKSYSTEM_HAS_STD_PARALLEL)
+  keys = base;
+  double sort_std_par = TimeMs([&]() { std::sort(std::execution::par, keys.begin(), keys.end()); });
+  double scan_std_par =
+    TimeMs([&]() { std::inclusive_scan(std::execution::par, values.begin(), values.end(), out.begin()); });
+  double transform_std_par =
+    TimeMs([&]() { std::transform(std::execution::par, values.begin(), values.end(), out.begin(), op); });
+  std::cout << "  std::execution::par: sort " << sort_std_par << " ms, scan " << scan_std_par << " ms, transform "
+            << transform_std_par << " ms\n";
+#else
+  std::cout << "  std::execution::par not available in this build\n";
+#endif
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== Parallel Algorithms Tests ===\n";
+  TestSortCorrectness();
+  TestScanCorrectness();
+  TestTransformCorrectness();
+  BenchmarkAgainstStandard();
+  std::cout << "\nAll Parallel Algorithms tests passed!\n";
+}
+
+}  // namespace ParallelAlgorithmsDemo
@@ -5,6 +5,7 @@
  *   - Demo 1: Basic awaitable async event with parallel handlers
  *   - Demo 2: Exception propagation from handlers to awaiter
  *   - Demo 3: Cancellation token integration
+ *   - Demo 4: Single-flight deduplication of identical in-flight publishes
  */
 
 #include <atomic>
@@ -17,6 +18,7 @@
 #include "CoroTask.hpp"
 #include "Event.hpp"
 #include "EventBus.hpp"
+#include "Events.hpp"
 #include "Task.hpp"
 #include "TaskAwaiter.hpp"
 #include "ThreadPool.hpp"
@@ -156,6 +158,42 @@ CoroTask<void> Demo3_Cancellation(ThreadPool& pool) {
   std::cout << "\u2713 Demo 3 passed\n";
 }
 
+void Demo4_SingleFlight(ThreadPool& pool) {
+  std::cout << "\n=== Demo 4: Single-Flight PublishAsync ===\n";
+
+  auto bus = std::make_shared<EventBus>(pool);
+  std::atomic<int> handler_count{0};
+
+  auto h1 = bus->Subscribe<SceneLoadedEvent>([&](const SceneLoadedEvent& event) {
+    std::cout << "  Handler processing: " << event.scene_name << "\n";
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    handler_count++;
+  });
+
+  std::cout << "Three systems publish the same scene, one publishes another...\n";
+  auto a = bus->PublishAsyncSingleFlight(SceneLoadedEvent{.scene_name = "forest", .load_time_ms = 12.0f});
+  auto b = bus->PublishAsyncSingleFlight(SceneLoadedEvent{.scene_name = "forest", .load_time_ms = 12.0f});
+  auto c = bus->PublishAsyncSingleFlight(SceneLoadedEvent{.scene_name = "forest", .load_time_ms = 12.0f});
+  auto d = bus->PublishAsyncSingleFlight(SceneLoadedEvent{.scene_name = "desert", .load_time_ms = 9.0f});
+
+  a->Wait();
+  b->Wait();
+  c->Wait();
+  d->Wait();
+
+  std::cout << "Handler executions: " << handler_count << " (expected: 2)\n";
+  assert(a == b && b == c);
+  assert(a != d);
+  assert(handler_count == 2);
+
+  std::cout << "Publishing forest again after completion...\n";
+  auto e = bus->PublishAsyncSingleFlight(SceneLoadedEvent{.scene_name = "forest", .load_time_ms = 12.0f});
+  e->Wait();
+  assert(e != a);
+  assert(handler_count == 3);
+  std::cout << "\u2713 Demo 4 passed\n";
+}
+
 void RunAll() {
   std::cout << "\n======================================\n";
   std::cout << "=== PublishAsync Demo Suite ===\n";
@@ -179,6 +217,11 @@ void RunAll() {
     coro.Wait();
   }
 
+  {
+    ThreadPool pool(4);
+    Demo4_SingleFlight(pool);
+  }
+
   std::cout << "\n=== All PublishAsync demos passed! ===" << std::endl;
 }
 
@@ -0,0 +1,239 @@
+/**
+ * @file ResultAccessDemo.cpp
+ * @brief Demonstrates reading Task<T> results in place: Result, SharedResult for fan-out readers, and TakeResult.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CoroTask.hpp"
+#include "Task.hpp"
+#include "TaskAwaiter.hpp"
+#include "ThreadPool.hpp"
+
+namespace ResultAccessDemo {
+
+// Large payload that counts how often it is copied
+struct MeshBuffer {
+  static inline std::atomic<int> copies{0};
+
+  std::vector<float> vertices;
+
+  explicit MeshBuffer(size_t count) : vertices(count, 1.0f) {
+  }
+  MeshBuffer(const MeshBuffer& other) : vertices(other.vertices) {
+    copies++;
+  }
+  MeshBuffer(MeshBuffer&&) noexcept = default;
+  MeshBuffer& operator=(const MeshBuffer&) = delete;
+  MeshBuffer& operator=(MeshBuffer&&) noexcept = default;
+};
+
+template <typename Exception, typename F>
+bool Throws(F&& fn) {
+  try {
+    fn();
+  } catch (const Exception&) {
+    return true;
+  }
+  return false;
+}
+
+// Tests that the result can be read any number of times, by any number of readers, without being moved away
+void TestRepeatedReads() {
+  std::cout << "\nTest 1: Repeated Reads\n";
+
+  ThreadPool pool(2);
+  auto task = std::make_shared<Task<std::string>>([]() { return std::string(64, 'x'); });
+  task->TrySchedule(pool);
+  task->Wait();
+
+  const std::string& first = task->Result();
+  std::string second = task->GetResult();
+  assert(first.size() == 64 && second == first && &task->Result() == &first);
+  std::cout << "  two reads, same value, same storage\n";
+  std::cout << "  PASS\n";
+}
+
+CoroTask<void> AwaitLength(std::shared_ptr<Task<std::string>> task, ThreadPool& pool, std::atomic<size_t>& total) {
+  TaskAwaiter<std::string> awaiter{task, pool};
+  std::string value = co_await awaiter;
+  total += value.size();
+}
+
+// Tests that several coroutines awaiting one task each see the full result
+void TestSeveralAwaiters() {
+  std::cout << "\nTest 2: Several Awaiters\n";
+
+  ThreadPool pool(2);
+  auto task = std::make_shared<Task<std::string>>([]() { return std::string(32, 'y'); });
+  std::atomic<size_t> total{0};
+  auto a = AwaitLength(task, pool, total);
+  auto b = AwaitLength(task, pool, total);
+  auto c = AwaitLength(task, pool, total);
+  a.Wait();
+  b.Wait();
+  c.Wait();
+
+  std::cout << "  3 awaiters read " << total << " characters\n";
+  assert(total == 96);
+  std::cout << "  PASS\n";
+}
+
+// Tests fan-out readers sharing one immutable buffer through SharedResult, without copies, past the task's lifetime
+void TestSharedFanOut() {
+  std::cout << "\nTest 3: Shared Fan-Out\n";
+
+  constexpr int kReaders = 8;
+  ThreadPool pool(3);
+  MeshBuffer::copies = 0;
+  auto build = std::make_shared<Task<MeshBuffer>>([]() { return MeshBuffer(1 << 20); });
+
+  std::vector<std::shared_ptr<const MeshBuffer>> seen(kReaders);
+  auto done = std::make_shared<Task<void>>([]() {});
+  for (int i = 0; i < kReaders; ++i) {
+    auto reader = std::make_shared<Task<void>>([&seen, i, weak = std::weak_ptr<Task<MeshBuffer>>(build)]() {
+      seen[i] = weak.lock()->SharedResult();
+    });
+    build->Then(reader);
+    reader->Then(done);
+  }
+  build->TrySchedule(pool);
+  done->Wait();
+  pool.Shutdown();  // joins the workers, so no finished job still holds the task
+
+  std::weak_ptr<Task<MeshBuffer>> watch = build;
+  build.reset();
+  assert(!watch.expired());  // the readers' pointers keep the task and its buffer alive
+
+  for (auto& mesh : seen) {
+    assert(mesh.get() == seen[0].get() && mesh->vertices.size() == (1 << 20));
+  }
+  std::cout << "  " << kReaders << " readers, " << MeshBuffer::copies << " copies of a 4 MB buffer\n";
+  assert(MeshBuffer::copies == 0);
+
+  seen.clear();
+  assert(watch.expired());
+  std::cout << "  PASS\n";
+}
+
+// Tests that TakeResult moves the value out exactly once and is refused once the result is shared
+void TestTakeResult() {
+  std::cout << "\nTest 4: Take Result\n";
+
+  ThreadPool pool(1);
+  auto owned = std::make_shared<Task<std::unique_ptr<int>>>([]() { return std::make_unique<int>(5); });
+  owned->TrySchedule(pool);
+  owned->Wait();
+
+  assert(*owned->Result() == 5);
+  std::unique_ptr<int> value = owned->TakeResult();
+  assert(value && *value == 5);
+  assert(Throws<std::logic_error>([&]() { owned->Result(); }));
+  assert(Throws<std::logic_error>([&]() { owned->TakeResult(); }));
+
+  auto shared = std::make_shared<Task<int>>([]() { return 9; });
+  shared->TrySchedule(pool);
+  shared->Wait();
+  auto pointer = shared->SharedResult();
+  assert(Throws<std::logic_error>([&]() { shared->TakeResult(); }));
+  assert(*pointer == 9 && shared->Result() == 9);
+
+  auto failed = std::make_shared<Task<int>>([]() -> int { throw std::runtime_error("load failed"); });
+  failed->TrySchedule(pool);
+  failed->Wait();
+  assert(Throws<std::runtime_error>([&]() { failed->Result(); }));
+  assert(Throws<std::runtime_error>([&]() { failed->SharedResult(); }));
+  std::cout << "  PASS\n";
+}
+
+CoroTask<void> AwaitMesh(std::shared_ptr<Task<MeshBuffer>> task, ThreadPool& pool, size_t& size) {
+  TaskAwaiter<MeshBuffer> awaiter{task, pool};
+  const MeshBuffer& mesh = co_await awaiter;
+  size = mesh.vertices.size();
+}
+
+CoroTask<void> AwaitOwned(std::shared_ptr<Task<std::unique_ptr<int>>> task, ThreadPool& pool, std::unique_ptr<int>& out) {
+  TaskAwaiter<std::unique_ptr<int>> awaiter{task, pool};
+  out = co_await awaiter;
+}
+
+// Tests that co_await reads a copyable result in place and moves a move-only result out
+void TestAwaitWithoutCopies() {
+  std::cout << "\nTest 5: Await Without Copies\n";
+
+  ThreadPool pool(2);
+  MeshBuffer::copies = 0;
+  auto build = std::make_shared<Task<MeshBuffer>>([]() { return MeshBuffer(1 << 16); });
+  size_t size = 0;
+  auto mesh_reader = AwaitMesh(build, pool, size);
+  mesh_reader.Wait();
+  assert(size == (1 << 16) && MeshBuffer::copies == 0);
+
+  auto owned = std::make_shared<Task<std::unique_ptr<int>>>([]() { return std::make_unique<int>(7); });
+  std::unique_ptr<int> out;
+  auto owner = AwaitOwned(owned, pool, out);
+  owner.Wait();
+  assert(out && *out == 7);
+  assert(Throws<std::logic_error>([&]() { owned->Result(); }));  // taken by the awaiter
+  std::cout << "  " << MeshBuffer::copies << " copies awaiting a mesh, move-only result moved out\n";
+  std::cout << "  PASS\n";
+}
+
+// Tests that SharedResult and TakeResult racing on one task never both succeed
+void TestRacingAccessors() {
+  std::cout << "\nTest 6: Racing Accessors\n";
+
+  constexpr int kRounds = 500;
+  ThreadPool pool(1);
+  int taken = 0;
+  int shared = 0;
+  for (int round = 0; round < kRounds; ++round) {
+    auto task = std::make_shared<Task<std::string>>([]() { return std::string(32, 'z'); });
+    task->TrySchedule(pool);
+    task->Wait();
+
+    std::shared_ptr<const std::string> pointer;
+    std::thread sharer([&]() {
+      try {
+        pointer = task->SharedResult();
+      } catch (const std::logic_error&) {
+      }
+    });
+    std::string value;
+    try {
+      value = task->TakeResult();
+    } catch (const std::logic_error&) {
+    }
+    sharer.join();
+
+    assert((pointer != nullptr) != !value.empty());  // exactly one accessor won
+    if (pointer) {
+      assert(pointer->size() == 32);  // never an alias of a moved-from string
+      shared++;
+    } else {
+      taken++;
+    }
+  }
+  std::cout << "  " << taken << " rounds taken, " << shared << " rounds shared\n";
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== Result Access Tests ===\n";
+  TestRepeatedReads();
+  TestSeveralAwaiters();
+  TestSharedFanOut();
+  TestTakeResult();
+  TestAwaitWithoutCopies();
+  TestRacingAccessors();
+  std::cout << "\nAll Result Access tests passed!\n";
+}
+
+}  // namespace ResultAccessDemo
@@ -0,0 +1,237 @@
+/**
+ * @file ShardedEventBusDemo.cpp
+ * @brief Demonstrates ShardedEventBus: per-shard ownership, cross-shard cascades, unsubscription and throughput.
+ * @details Handlers in these tests update plain, non-atomic per-entity state. That is only correct because every
+ *          entity's handlers run on its owning shard's thread. Build with -fsanitize=thread to have that checked.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "EventBus.hpp"
+#include "ShardedEventBus.hpp"
+#include "SubjectID.hpp"
+#include "ThreadPool.hpp"
+
+namespace ShardedEventBusDemo {
+
+struct HitEvent : Event<HitEvent> {
+  static constexpr std::string_view EventName = "sharded.hit";
+  int amount;
+  int hop;
+};
+
+// Tests that each entity's handlers run on its owning shard, and only there
+void TestOwnership() {
+  std::cout << "\nTest 1: Shard Ownership\n";
+
+  constexpr uint64_t kEntities = 64;
+  constexpr int kHitsPerEntity = 100;
+  auto bus = std::make_shared<ShardedEventBus>(4);
+
+  std::vector<int> health(kEntities, 0);  // owner-thread state, deliberately not atomic
+  std::vector<std::thread::id> owner(bus->GetShardCount());
+  std::atomic<int> wrong_shard{0};
+  std::vector<ShardedEventHandle> handles;
+  for (uint64_t id = 0; id < kEntities; ++id) {
+    handles.push_back(bus->SubscribeTargeted<HitEvent>(SubjectID(id), [&, id](const HitEvent& event) {
+      size_t shard = bus->ShardOf(SubjectID(id));
+      if (bus->CurrentShard() != shard) {
+        wrong_shard++;
+      }
+      if (owner[shard] == std::thread::id()) {
+        owner[shard] = std::this_thread::get_id();
+      } else if (owner[shard] != std::this_thread::get_id()) {
+        wrong_shard++;
+      }
+      health[id] += event.amount;
+    }));
+  }
+
+  for (int hit = 0; hit < kHitsPerEntity; ++hit) {
+    for (uint64_t id = 0; id < kEntities; ++id) {
+      bus->EmitTargeted(HitEvent{.amount = 1, .hop = 0}, SubjectID(id));
+    }
+  }
+  bus->WaitIdle();
+
+  assert(wrong_shard == 0);
+  for (int value : health) {
+    assert(value == kHitsPerEntity);
+  }
+  assert(!bus->CurrentShard());
+  for (const auto& stats : bus->GetStats()) {
+    std::cout << "  shard delivered " << stats.delivered << "\n";
+  }
+  std::cout << "  PASS\n";
+}
+
+// Tests that handlers emitting to other entities form cascades that WaitIdle waits out, with same-shard hops staying local
+void TestCascade() {
+  std::cout << "\nTest 2: Cross-Shard Cascade\n";
+
+  constexpr uint64_t kEntities = 256;
+  constexpr int kHops = 20;
+  auto bus = std::make_shared<ShardedEventBus>(4);
+
+  std::vector<int> received(kEntities, 0);
+  std::vector<ShardedEventHandle> handles;
+  for (uint64_t id = 0; id < kEntities; ++id) {
+    handles.push_back(bus->SubscribeTargeted<HitEvent>(SubjectID(id), [&, id](const HitEvent& event) {
+      received[id]++;
+      if (event.hop + 1 < kHops) {
+        bus->EmitTargeted(HitEvent{.amount = event.amount, .hop = event.hop + 1}, SubjectID((id * 7 + 1) % kEntities));
+      }
+    }));
+  }
+
+  // Subscribe followed by emit from one thread is delivered in that order, without waiting in between
+  for (uint64_t id = 0; id < kEntities; ++id) {
+    bus->EmitTargeted(HitEvent{.amount = 1, .hop = 0}, SubjectID(id));
+  }
+  bus->WaitIdle();
+
+  int total = 0;
+  for (int count : received) {
+    total += count;
+  }
+  uint64_t local = 0;
+  uint64_t remote = 0;
+  for (const auto& stats : bus->GetStats()) {
+    local += stats.local_posts;
+    remote += stats.remote_posts;
+  }
+  std::cout << "  " << total << " deliveries, " << local << " same-shard posts, " << remote << " mailbox posts\n";
+  assert(total == static_cast<int>(kEntities) * kHops);
+  assert(local > 0);
+
+  bool refused = false;
+  std::atomic<bool> checked{false};
+  auto probe = bus->SubscribeTargeted<HitEvent>(SubjectID(kEntities), [&](const HitEvent&) {
+    try {
+      bus->WaitIdle();
+    } catch (const std::logic_error&) {
+      refused = true;
+    }
+    checked = true;
+  });
+  bus->EmitTargeted(HitEvent{.amount = 0, .hop = kHops}, SubjectID(kEntities));
+  bus->WaitIdle();
+  assert(checked && refused);
+  std::cout << "  PASS\n";
+}
+
+// Tests that unsubscribed handlers get no further events, including when a handler unsubscribes itself
+void TestUnsubscribe() {
+  std::cout << "\nTest 3: Unsubscribe\n";
+
+  auto bus = std::make_shared<ShardedEventBus>(2);
+  int count = 0;
+  {
+    auto handle = bus->SubscribeTargeted<HitEvent>(SubjectID(1), [&count](const HitEvent&) { count++; });
+    bus->EmitTargeted(HitEvent{.amount = 1, .hop = 0}, SubjectID(1));
+    bus->WaitIdle();
+    assert(count == 1);
+  }
+  bus->EmitTargeted(HitEvent{.amount = 1, .hop = 0}, SubjectID(1));
+  bus->WaitIdle();
+  assert(count == 1);
+
+  int once = 0;
+  std::optional<ShardedEventHandle> self;
+  self.emplace(bus->SubscribeTargeted<HitEvent>(SubjectID(2), [&](const HitEvent&) {
+    once++;
+    self->Unsubscribe();
+  }));
+  for (int i = 0; i < 5; ++i) {
+    bus->EmitTargeted(HitEvent{.amount = 1, .hop = 0}, SubjectID(2));
+  }
+  bus->WaitIdle();
+  assert(once == 1);
+  std::cout << "  PASS\n";
+}
+
+// Compares targeted throughput from several producers: EventBus::EmitTargeted against ShardedEventBus shard counts
+void TestThroughput() {
+  std::cout << "\nTest 4: Throughput\n";
+
+  constexpr uint64_t kEntities = 4096;
+  constexpr int kProducers = 4;
+  constexpr int kEventsPerProducer = 50000;
+  constexpr int kTotal = kProducers * kEventsPerProducer;
+
+  auto produce = [](auto&& emit) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+      producers.emplace_back([&emit, p]() {
+        for (int i = 0; i < kEventsPerProducer; ++i) {
+          emit(HitEvent{.amount = 1, .hop = 0}, SubjectID((static_cast<uint64_t>(i) * kProducers + p) % kEntities));
+        }
+      });
+    }
+    for (auto& producer : producers) {
+      producer.join();
+    }
+    return start;
+  };
+  auto elapsed_ms = [](std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  };
+
+  {
+    ThreadPool pool(2);
+    auto bus = std::make_shared<EventBus>(pool);
+    std::vector<std::atomic<int>> health(kEntities);  // handlers run on the emitting threads, so state must be atomic
+    std::vector<EventHandle> handles;
+    for (uint64_t id = 0; id < kEntities; ++id) {
+      handles.push_back(bus->SubscribeTargeted<HitEvent>(SubjectID(id), [&health, id](const HitEvent& event) {
+        health[id].fetch_add(event.amount, std::memory_order_relaxed);
+      }));
+    }
+    auto start = produce([&](const HitEvent& event, SubjectID target) { bus->EmitTargeted(event, target); });
+    double ms = elapsed_ms(start);
+    std::cout << "  EventBus:              " << ms << " ms (" << static_cast<int>(kTotal / ms) << " events/ms)\n";
+  }
+
+  for (size_t shards : {size_t{1}, size_t{2}, size_t{4}}) {
+    auto bus = std::make_shared<ShardedEventBus>(shards);
+    std::vector<int> health(kEntities, 0);
+    std::vector<ShardedEventHandle> handles;
+    for (uint64_t id = 0; id < kEntities; ++id) {
+      handles.push_back(
+        bus->SubscribeTargeted<HitEvent>(SubjectID(id), [&health, id](const HitEvent& event) { health[id] += event.amount; }));
+    }
+    bus->WaitIdle();
+    auto start = produce([&](const HitEvent& event, SubjectID target) { bus->EmitTargeted(event, target); });
+    bus->WaitIdle();
+    double ms = elapsed_ms(start);
+
+    int total = 0;
+    for (int value : health) {
+      total += value;
+    }
+    assert(total == kTotal);
+    std::cout << "  ShardedEventBus x" << shards << ":   " << ms << " ms (" << static_cast<int>(kTotal / ms) << " events/ms)\n";
+  }
+  std::cout << "  (" << std::thread::hardware_concurrency() << " hardware threads)\n";
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== Sharded EventBus Tests ===\n";
+  TestOwnership();
+  TestCascade();
+  TestUnsubscribe();
+  TestThroughput();
+  std::cout << "\nAll Sharded EventBus tests passed!\n";
+}
+
+}  // namespace ShardedEventBusDemo
@@ -0,0 +1,273 @@
+/**
+ * @file ShutdownDemo.cpp
+ * @brief Demonstrates ThreadPool::Shutdown in drain, discard-pending and deadline modes, and its report.
+ * @details Every test uses a single-worker pool whose worker is busy with a first job when Shutdown is called, so what
+ *          is still queued at that point is known exactly. Test 5 covers work that is not a Task job itself:
+ *          PublishAsync handler jobs and fiber resumptions.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "EventBus.hpp"
+#include "Events.hpp"
+#include "Fiber.hpp"
+#include "Task.hpp"
+#include "TaskAwaiter.hpp"
+#include "ThreadPool.hpp"
+
+namespace ShutdownDemo {
+
+using namespace std::chrono_literals;
+
+void PrintReport(const ThreadPool::ShutdownReport& report) {
+  std::cout << "  executed " << report.executed << ", discarded " << report.discarded << ", tasks cancelled "
+            << report.tasksCancelled << ", timers discarded " << report.timersDiscarded
+            << (report.timedOut ? ", timed out" : "") << ", took "
+            << std::chrono::duration<double, std::milli>(report.elapsed).count() << " ms\n";
+}
+
+// Occupies the worker until released, and returns once it has started
+void BlockWorker(ThreadPool& pool, std::atomic<bool>& release) {
+  std::atomic<bool> started{false};
+  pool.Enqueue([&]() {
+    started = true;
+    while (!release) {
+      std::this_thread::sleep_for(1ms);
+    }
+  });
+  while (!started) {
+    std::this_thread::yield();
+  }
+}
+
+// Releases the blocker shortly after Shutdown has been called from this thread
+std::thread ReleaseLater(std::atomic<bool>& release, std::chrono::milliseconds after) {
+  return std::thread([&release, after]() {
+    std::this_thread::sleep_for(after);
+    release = true;
+  });
+}
+
+// Tests that Drain runs everything queued, including work enqueued by the jobs it runs
+void TestDrain() {
+  std::cout << "\nTest 1: Drain\n";
+
+  ThreadPool pool(1);
+  std::atomic<bool> release{false};
+  std::atomic<int> ran{0};
+  BlockWorker(pool, release);
+
+  for (int i = 0; i < 50; ++i) {
+    pool.Enqueue([&]() {
+      ran++;
+      if (ran == 50) {
+        pool.Enqueue([&]() { ran++; });  // enqueued during shutdown, still drained
+      }
+    });
+  }
+  std::thread releaser = ReleaseLater(release, 10ms);
+  auto report = pool.Shutdown(ThreadPool::ShutdownMode::Drain);
+  releaser.join();
+  PrintReport(report);
+
+  assert(ran == 51);
+  assert(report.executed == 51 && report.discarded == 0 && !report.timedOut);
+  std::cout << "  PASS\n";
+}
+
+// Tests that DiscardPending drops queued jobs and completes queued Tasks as cancelled, waking their waiters
+void TestDiscardPending() {
+  std::cout << "\nTest 2: Discard Pending\n";
+
+  constexpr int kJobs = 100;
+  constexpr int kTasks = 20;
+  ThreadPool pool(1);
+  std::atomic<bool> release{false};
+  std::atomic<int> ran{0};
+  BlockWorker(pool, release);
+
+  for (int i = 0; i < kJobs; ++i) {
+    pool.Enqueue([&]() { ran++; });
+  }
+  std::vector<std::shared_ptr<Task<int>>> tasks;
+  std::vector<std::shared_ptr<Task<void>>> then_successors;
+  for (int i = 0; i < kTasks; ++i) {
+    auto task = std::make_shared<Task<int>>([&ran]() { return ++ran; });
+    then_successors.push_back(task->Then(std::make_shared<Task<void>>([&ran]() { ran++; })));
+    task->TrySchedule(pool);
+    tasks.push_back(task);
+  }
+
+  // A waiter parked on a queued task must wake up with the shutdown
+  std::atomic<bool> waiter_saw_cancel{false};
+  std::thread waiter([&]() {
+    tasks.back()->Wait();
+    try {
+      tasks.back()->GetResult();
+    } catch (const TaskDiscardedException&) {
+      waiter_saw_cancel = true;
+    }
+  });
+
+  std::thread releaser = ReleaseLater(release, 10ms);
+  auto report = pool.Shutdown(ThreadPool::ShutdownMode::DiscardPending);
+  releaser.join();
+  waiter.join();
+  PrintReport(report);
+
+  assert(ran == 0);
+  assert(report.executed == 0);
+  assert(report.discarded == kJobs + kTasks && report.tasksCancelled == kTasks);
+  for (auto& task : tasks) {
+    assert(task->IsDone());
+  }
+  for (auto& next : then_successors) {
+    assert(next->IsDone());  // skipped inline by the cancelled predecessor, never queued
+  }
+  assert(waiter_saw_cancel);
+  std::cout << "  PASS\n";
+}
+
+// Tests that Deadline drains until the timeout and then discards the rest, so the shutdown time is bounded
+void TestDeadline() {
+  std::cout << "\nTest 3: Deadline\n";
+
+  constexpr int kJobs = 200;
+  {
+    ThreadPool pool(1);
+    std::atomic<bool> release{true};
+    std::atomic<int> ran{0};
+    BlockWorker(pool, release);
+    for (int i = 0; i < kJobs; ++i) {
+      pool.Enqueue([&]() {
+        std::this_thread::sleep_for(2ms);
+        ran++;
+      });
+    }
+
+    auto report = pool.Shutdown(ThreadPool::ShutdownMode::Deadline, 40ms);
+    PrintReport(report);
+    assert(report.timedOut);
+    assert(report.elapsed < 200ms);  // draining all of it would take at least 400 ms
+    assert(ran > 0 && static_cast<uint64_t>(ran) + report.discarded == kJobs);
+  }
+  {
+    ThreadPool pool(1);
+    std::atomic<int> ran{0};
+    for (int i = 0; i < 5; ++i) {
+      pool.Enqueue([&]() { ran++; });
+    }
+    auto report = pool.Shutdown(ThreadPool::ShutdownMode::Deadline, 1s);
+    PrintReport(report);
+    assert(!report.timedOut && ran == 5 && report.discarded == 0);
+  }
+  std::cout << "  PASS\n";
+}
+
+// Tests that pending timers are discarded, that a delayed task completes as cancelled, and that work submitted to a
+// pool that has shut down is discarded on the spot
+void TestTimersAndLateWork() {
+  std::cout << "\nTest 4: Timers And Late Work\n";
+
+  ThreadPool pool(1);
+  std::atomic<int> ran{0};
+  auto delayed = std::make_shared<Task<void>>([&]() { ran++; });
+  auto cleanup = delayed->Finally(std::make_shared<Task<void>>([&]() { ran++; }));
+  pool.ScheduleAfter(10s, delayed);
+  pool.ScheduleEvery(10s, [&]() { ran++; }, nullptr);
+
+  auto report = pool.Shutdown(ThreadPool::ShutdownMode::Drain);
+  PrintReport(report);
+  assert(report.timersDiscarded == 2 && report.tasksCancelled == 1);
+  assert(delayed->IsDone() && cleanup->IsDone());
+  assert(ran == 1);  // the Finally cleanup was drained; the delayed task and the periodic job never ran
+
+  auto late = std::make_shared<Task<int>>([]() { return 1; });
+  late->TrySchedule(pool);
+  assert(late->IsDone());
+  bool cancelled = false;
+  try {
+    late->GetResult();
+  } catch (const TaskCancelledException&) {
+    cancelled = true;
+  }
+  assert(cancelled);
+
+  auto again = pool.Shutdown(ThreadPool::ShutdownMode::DiscardPending);
+  assert(again.executed == 0 && again.discarded == 0);  // only the first call does anything
+  std::cout << "  PASS\n";
+}
+
+// True when a finished task failed with TaskDiscardedException
+bool WasDiscarded(const std::shared_ptr<Task<void>>& task, ThreadPool& pool) {
+  try {
+    TaskAwaiter<void>{task, pool}.await_resume();
+  } catch (const TaskDiscardedException&) {
+    return true;
+  }
+  return false;
+}
+
+// Tests that discarded PublishAsync handler jobs and fiber resumptions still complete their tasks, so waiters wake up
+void TestDiscardedDispatch() {
+  std::cout << "\nTest 5: Discarded PublishAsync And Fibers\n";
+
+  ThreadPool pool(1);
+  auto bus = std::make_shared<EventBus>(pool);
+  std::atomic<bool> release{false};
+  std::atomic<int> ran{0};
+
+  // Parks on gate before the worker is blocked; gate's job and then the fiber's resumption are discarded
+  auto gate = std::make_shared<Task<void>>([]() {});
+  std::atomic<bool> fiber_started{false};
+  auto parked = Fiber::Spawn(pool, [&]() {
+    fiber_started = true;
+    gate->Wait();
+    ran++;
+  });
+  while (!fiber_started) {
+    std::this_thread::yield();
+  }
+  BlockWorker(pool, release);  // starts only once the fiber has parked and freed the worker
+  gate->TrySchedule(pool);
+
+  std::vector<EventHandle> handles;
+  for (int i = 0; i < 3; ++i) {
+    handles.push_back(bus->Subscribe<PlayerDamagedEvent>([&ran](const PlayerDamagedEvent&) { ran++; }));
+  }
+  auto publish = bus->PublishAsync(PlayerDamagedEvent{.player_id = 1, .damage = 1.0f});
+  auto unstarted = Fiber::Spawn(pool, [&]() { ran++; });
+
+  std::thread waiter([&]() { publish->Wait(); });
+
+  std::thread releaser = ReleaseLater(release, 10ms);
+  auto report = pool.Shutdown(ThreadPool::ShutdownMode::DiscardPending);
+  releaser.join();
+  waiter.join();
+  PrintReport(report);
+
+  assert(ran == 0);
+  assert(report.discarded == 6 && report.tasksCancelled == 6);  // gate, 3 handler jobs, fiber start, resumption
+  for (auto* task : {&publish, &parked, &unstarted}) {
+    assert((*task)->IsDone() && WasDiscarded(*task, pool));
+  }
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== Thread Pool Shutdown Tests ===\n";
+  TestDrain();
+  TestDiscardPending();
+  TestDeadline();
+  TestTimersAndLateWork();
+  TestDiscardedDispatch();
+  std::cout << "\nAll Thread Pool Shutdown tests passed!\n";
+}
+
+}  // namespace ShutdownDemo
@@ -0,0 +1,313 @@
+/**
+ * @file StressDemo.cpp
+ * @brief Time-bounded race suite for the Task DAG, EventBus and CancellationToken.
+ * @details Each test hammers one concurrency contract from several threads for about a second and then checks the
+ *          invariants that must hold however the threads interleaved. Build with the `linux-tsan` preset (or
+ *          `-fsanitize=thread`) to have ThreadSanitizer report the races these tests provoke.
+ * @note Throughput counters are printed for comparison between builds; only the invariants are asserted
+ */
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "CancellationToken.hpp"
+#include "EventBus.hpp"
+#include "EventScope.hpp"
+#include "Events.hpp"
+#include "SubjectID.hpp"
+#include "Task.hpp"
+#include "TaskExtensions.hpp"
+#include "ThreadPool.hpp"
+
+namespace StressDemo {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto kTestDuration = std::chrono::milliseconds(1000);
+
+void Report(const char* what, uint64_t count, Clock::time_point start) {
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  std::cout << "  " << what << ": " << count << " (" << static_cast<uint64_t>(count / seconds) << "/s)\n";
+}
+
+// Tests DAG edges added from several threads while predecessors are already running or finished.
+// Every successor is held with a pending signal until its owner thread has attached all of its edges.
+void TestConcurrentDagConstruction() {
+  std::cout << "\nTest 1: Concurrent DAG Construction\n";
+
+  constexpr int kTasks = 512;
+  constexpr int kBuilders = 3;
+  constexpr int kMaxFanIn = 4;
+
+  ThreadPool pool(2);
+  uint64_t total_tasks = 0;
+  uint64_t total_edges = 0;
+  auto start = Clock::now();
+
+  do {
+    std::atomic<uint64_t> sequence{0};
+    std::vector<std::atomic<int>> runs(kTasks);
+    std::vector<uint64_t> started(kTasks);
+    std::vector<uint64_t> finished(kTasks);
+
+    std::vector<std::shared_ptr<Task<void>>> tasks;
+    tasks.reserve(kTasks);
+    for (int i = 0; i < kTasks; ++i) {
+      tasks.push_back(std::make_shared<Task<void>>([&, i]() {
+        started[i] = sequence.fetch_add(1, std::memory_order_relaxed);
+        runs[i].fetch_add(1, std::memory_order_relaxed);
+        finished[i] = sequence.fetch_add(1, std::memory_order_relaxed);
+      }));
+      tasks.back()->AddPendingSignals(1);
+    }
+
+    std::vector<std::vector<std::pair<int, int>>> edges(kBuilders);
+    std::vector<std::thread> builders;
+    for (int b = 0; b < kBuilders; ++b) {
+      builders.emplace_back([&, b]() {
+        std::mt19937 rng(static_cast<uint32_t>(total_tasks + b));
+        // Builder b owns successors b, b + kBuilders, ... and releases each one after wiring its predecessors
+        for (int to = b; to < kTasks; to += kBuilders) {
+          int fan_in = to == 0 ? 0 : static_cast<int>(rng() % (kMaxFanIn + 1));
+          for (int e = 0; e < fan_in; ++e) {
+            int from = static_cast<int>(rng() % to);
+            if (rng() % 2) {
+              tasks[from]->Then(tasks[to]);
+            } else {
+              tasks[from]->Finally(tasks[to]);
+            }
+            edges[b].emplace_back(from, to);
+          }
+          tasks[to]->OnPredecessorFinished(pool);
+        }
+      });
+    }
+    for (auto& builder : builders) {
+      builder.join();
+    }
+
+    for (auto& task : tasks) {
+      task->Wait();
+    }
+
+    for (int i = 0; i < kTasks; ++i) {
+      assert(runs[i] == 1);
+    }
+    for (const auto& owned : edges) {
+      for (auto [from, to] : owned) {
+        assert(finished[from] < started[to]);
+      }
+      total_edges += owned.size();
+    }
+    total_tasks += kTasks;
+  } while (Clock::now() - start < kTestDuration);
+
+  Report("tasks", total_tasks, start);
+  Report("edges", total_edges, start);
+  std::cout << "  PASS\n";
+}
+
+// Tests subscribe/unsubscribe and EventScope teardown racing Emit, EmitTargeted and PublishAsync.
+// A permanent subscriber must see every emit exactly once regardless of the churn around it.
+void TestSubscriptionChurn() {
+  std::cout << "\nTest 2: Subscription Churn\n";
+
+  constexpr uint64_t kTargets = 16;
+
+  ThreadPool pool(2);
+  auto bus = std::make_shared<EventBus>(pool);
+
+  std::atomic<uint64_t> permanent_calls{0};
+  std::atomic<uint64_t> permanent_targeted_calls{0};
+  auto permanent = bus->Subscribe<PlayerDamagedEvent>([&](const PlayerDamagedEvent&) { permanent_calls++; });
+  auto permanent_targeted = bus->SubscribeTargeted<CollisionEvent>(SubjectID(0), [&](const CollisionEvent&) {
+    permanent_targeted_calls++;
+  });
+
+  std::atomic<bool> stop{false};
+  std::atomic<uint64_t> emits{0};
+  std::atomic<uint64_t> targeted_emits{0};
+  std::atomic<uint64_t> published{0};
+  std::atomic<uint64_t> churned{0};
+
+  auto churn_calls = std::make_shared<std::atomic<uint64_t>>(0);  // outlives every handler that touches it
+
+  std::thread emitter([&]() {
+    std::mt19937 rng(1);
+    while (!stop) {
+      bus->Emit(PlayerDamagedEvent{.player_id = 1, .damage = 1.0f});
+      emits++;
+
+      uint64_t target = rng() % kTargets;
+      bus->EmitTargeted(CollisionEvent{.entity_a_id = target, .entity_b_id = 0, .category_a = EntityCategory::Player,
+                                       .category_b = EntityCategory::Wall, .force = 1.0f},
+                        SubjectID(target));
+      if (target == 0) {
+        targeted_emits++;
+      }
+    }
+  });
+
+  std::thread publisher([&]() {
+    while (!stop) {
+      bus->PublishAsync(PlayerDamagedEvent{.player_id = 2, .damage = 1.0f})->Wait();
+      published++;
+    }
+  });
+
+  std::thread churner([&]() {
+    std::mt19937 rng(2);
+    while (!stop) {
+      {
+        auto handle = bus->Subscribe<PlayerDamagedEvent>([churn_calls](const PlayerDamagedEvent&) { (*churn_calls)++; });
+        auto targeted = bus->SubscribeTargeted<CollisionEvent>(SubjectID(rng() % kTargets), [churn_calls](const CollisionEvent&) {
+          (*churn_calls)++;
+        });
+        auto sticky = bus->Subscribe<SceneLoadedEvent>([churn_calls](const SceneLoadedEvent&) { (*churn_calls)++; });
+      }
+      {
+        EventScope scope;
+        scope.Subscribe<PlayerDamagedEvent>(*bus, [churn_calls](const PlayerDamagedEvent&) { (*churn_calls)++; });
+        scope.Subscribe<CollisionEvent>(*bus, SubjectID(rng() % kTargets), [churn_calls](const CollisionEvent&) {
+          (*churn_calls)++;
+        });
+        scope.SubscribeAsync<PlayerDamagedEvent>(*bus, [churn_calls](const PlayerDamagedEvent&) { (*churn_calls)++; });
+      }
+      bus->Emit(SceneLoadedEvent{.scene_name = "churn", .load_time_ms = 0.0f});
+      churned++;
+    }
+  });
+
+  auto start = Clock::now();
+  std::this_thread::sleep_for(kTestDuration);
+  stop = true;
+  emitter.join();
+  publisher.join();
+  churner.join();
+
+  Report("emits", emits + published, start);
+  Report("subscription cycles", churned, start);
+  assert(permanent_calls == emits + published);
+  assert(permanent_targeted_calls == targeted_emits);
+  std::cout << "  PASS\n";
+}
+
+// Tests Cancel racing RegisterCallback: every callback runs exactly once, including ones registered from a callback
+void TestCancellationRace() {
+  std::cout << "\nTest 3: Cancellation Race\n";
+
+  constexpr int kCallbacks = 64;
+
+  uint64_t rounds = 0;
+  auto start = Clock::now();
+  do {
+    auto token = MakeCancellationToken();
+    std::atomic<int> calls{0};
+    std::atomic<bool> go{false};
+
+    std::thread registrar([&]() {
+      while (!go) {
+        std::this_thread::yield();
+      }
+      for (int i = 0; i < kCallbacks; ++i) {
+        token->RegisterCallback([&]() {
+          calls++;
+          token->RegisterCallback([&]() { calls++; });  // runs inline: the token is cancelled by now
+        });
+      }
+    });
+    std::thread canceller([&]() {
+      while (!go) {
+        std::this_thread::yield();
+      }
+      token->Cancel();
+    });
+
+    go = true;
+    registrar.join();
+    canceller.join();
+
+    assert(calls == 2 * kCallbacks);
+    ++rounds;
+  } while (Clock::now() - start < kTestDuration);
+
+  Report("cancel rounds", rounds, start);
+  std::cout << "  PASS\n";
+}
+
+// Tests WhenAllWithCancellation while the token is cancelled mid-flight: every child settles exactly once and the
+// aggregate's success continuation runs only when no child observed the cancellation
+void TestWhenAllCancellation() {
+  std::cout << "\nTest 4: WhenAll Cancellation\n";
+
+  constexpr int kChildren = 16;
+
+  ThreadPool pool(2);
+  uint64_t rounds = 0;
+  uint64_t cancelled_rounds = 0;
+  auto start = Clock::now();
+  do {
+    auto token = MakeCancellationToken();
+    std::atomic<int> runs{0};
+    std::atomic<int> completed{0};
+
+    std::vector<std::shared_ptr<Task<void>>> children;
+    for (int i = 0; i < kChildren; ++i) {
+      children.push_back(WithCancellation<void>([&]() { completed++; }, token));
+      children.back()->Finally(std::make_shared<Task<void>>([&]() { runs++; }));
+    }
+
+    std::thread canceller([&]() {
+      std::this_thread::yield();
+      token->Cancel();
+    });
+    auto aggregate = WhenAllWithCancellation(pool, children, token);
+
+    std::atomic<bool> succeeded{false};
+    auto on_success = aggregate->Then(std::make_shared<Task<void>>([&]() { succeeded = true; }));
+    auto settled = aggregate->Finally(std::make_shared<Task<void>>([]() {}));
+
+    canceller.join();
+    settled->Wait();
+    for (auto& child : children) {
+      child->Wait();
+    }
+    if (succeeded) {
+      on_success->Wait();
+    }
+
+    while (runs < kChildren) {
+      std::this_thread::yield();  // child Finally continuations may still be queued
+    }
+    assert(runs == kChildren);
+    if (succeeded) {
+      assert(completed == kChildren);
+    } else {
+      ++cancelled_rounds;
+    }
+    ++rounds;
+  } while (Clock::now() - start < kTestDuration);
+
+  Report("rounds", rounds, start);
+  std::cout << "  cancelled: " << cancelled_rounds << "\n";
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== Stress Tests ===\n";
+  TestConcurrentDagConstruction();
+  TestSubscriptionChurn();
+  TestCancellationRace();
+  TestWhenAllCancellation();
+  std::cout << "\nAll Stress tests passed!\n";
+}
+
+}  // namespace StressDemo
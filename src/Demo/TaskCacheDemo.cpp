@@ -0,0 +1,164 @@
+/**
+ * @file TaskCacheDemo.cpp
+ * @brief Demonstrates TaskCache in-flight sharing, LRU hits, byte-budget eviction and failure handling.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Task.hpp"
+#include "TaskCache.hpp"
+#include "ThreadPool.hpp"
+
+namespace TaskCacheDemo {
+
+struct ShaderBlob {
+  std::string name;
+  std::vector<char> bytes;
+};
+
+size_t BlobSize(const ShaderBlob& blob) {
+  return blob.bytes.size();
+}
+
+// Tests that concurrent requests for one key share a single in-flight task
+void TestInFlightSharing() {
+  std::cout << "\nTest 1: In-Flight Sharing\n";
+
+  ThreadPool pool(4);
+  TaskCache<std::string, ShaderBlob> cache(pool, 1024 * 1024, BlobSize);
+  std::atomic<int> compile_count{0};
+
+  auto compile = [&compile_count]() {
+    compile_count++;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    return ShaderBlob{"lit.vs", std::vector<char>(256, 'x')};
+  };
+
+  std::vector<std::shared_ptr<Task<ShaderBlob>>> requests;
+  for (int i = 0; i < 8; ++i) {
+    requests.push_back(cache.GetOrCreate("lit.vs", compile));
+  }
+
+  for (auto& request : requests) {
+    request->Wait();
+  }
+
+  auto stats = cache.GetStats();
+  std::cout << "  Factory runs: " << compile_count << " (expected: 1)\n";
+  std::cout << "  Misses: " << stats.misses << ", joins: " << stats.joins << "\n";
+  assert(compile_count == 1);
+  assert(stats.misses == 1 && stats.joins == 7);
+  assert(requests.front() == requests.back());
+  std::cout << "  PASS\n";
+}
+
+// Tests that completed results are served from the LRU without re-running the factory
+void TestCompletedHit() {
+  std::cout << "\nTest 2: Completed Result Hit\n";
+
+  ThreadPool pool(4);
+  TaskCache<int, int> cache(pool, 1024);
+  std::atomic<int> run_count{0};
+
+  auto first = cache.GetOrCreate(7, [&run_count]() {
+    run_count++;
+    return 49;
+  });
+  first->Wait();
+
+  auto second = cache.GetOrCreate(7, [&run_count]() {
+    run_count++;
+    return -1;
+  });
+  second->Wait();
+
+  std::cout << "  Second result: " << second->GetResult() << " (expected: 49)\n";
+  assert(second->GetResult() == 49);
+  assert(run_count == 1);
+  assert(cache.GetStats().hits == 1);
+  assert(cache.Peek(7) && *cache.Peek(7) == 49);
+  std::cout << "  PASS\n";
+}
+
+// Tests that the byte budget evicts least recently used entries and reports them
+void TestByteBudgetEviction() {
+  std::cout << "\nTest 3: Byte Budget Eviction\n";
+
+  ThreadPool pool(4);
+  TaskCache<std::string, ShaderBlob> cache(pool, 1000, BlobSize);
+
+  std::vector<std::string> evicted;
+  cache.SetEvictionCallback([&evicted](const std::string& key, size_t bytes) {
+    std::cout << "  Evicted " << key << " (" << bytes << " bytes)\n";
+    evicted.push_back(key);
+  });
+
+  auto load = [&cache](const std::string& name) {
+    auto task = cache.GetOrCreate(name, [name]() { return ShaderBlob{name, std::vector<char>(400, 'x')}; });
+    task->Wait();
+  };
+
+  load("a");
+  load("b");
+  load("a");  // touch "a" so "b" becomes least recently used
+  load("c");  // 1200 bytes > 1000, evicts "b"
+
+  auto stats = cache.GetStats();
+  std::cout << "  Entries: " << stats.entries << ", bytes: " << stats.bytes << "\n";
+  assert(evicted.size() == 1 && evicted.front() == "b");
+  assert(stats.evictions == 1 && stats.bytes == 800);
+  assert(cache.Peek("a") && !cache.Peek("b") && cache.Peek("c"));
+  std::cout << "  PASS\n";
+}
+
+// Tests that a failing factory is not cached and the next request retries
+void TestFailureNotCached() {
+  std::cout << "\nTest 4: Failures Are Not Cached\n";
+
+  ThreadPool pool(4);
+  TaskCache<int, int> cache(pool, 1024);
+  std::atomic<int> attempts{0};
+
+  auto failing = cache.GetOrCreate(1, [&attempts]() -> int {
+    attempts++;
+    throw std::runtime_error("navmesh tile corrupt");
+  });
+  failing->Wait();
+
+  bool caught = false;
+  try {
+    failing->GetResult();
+  } catch (const std::runtime_error& e) {
+    std::cout << "  Caught: " << e.what() << "\n";
+    caught = true;
+  }
+
+  auto retry = cache.GetOrCreate(1, [&attempts]() {
+    attempts++;
+    return 5;
+  });
+  retry->Wait();
+
+  assert(caught);
+  assert(attempts == 2);
+  assert(retry->GetResult() == 5);
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== TaskCache Tests ===\n";
+  TestInFlightSharing();
+  TestCompletedHit();
+  TestByteBudgetEviction();
+  TestFailureNotCached();
+  std::cout << "\nAll TaskCache tests passed!\n";
+}
+
+}  // namespace TaskCacheDemo
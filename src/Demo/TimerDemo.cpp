@@ -0,0 +1,173 @@
+/**
+ * @file TimerDemo.cpp
+ * @brief Demonstrates delayed and periodic scheduling on the pool's timer heap, and the Delay awaiter.
+ * @details Every test uses a single-worker pool and checks that the worker stays free while timers are pending,
+ *          which is the point of the timer thread compared to sleep_for inside a job.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "CancellationToken.hpp"
+#include "CoroTask.hpp"
+#include "DelayAwaiter.hpp"
+#include "Task.hpp"
+#include "ThreadPool.hpp"
+
+namespace TimerDemo {
+
+using namespace std::chrono_literals;
+using Clock = ThreadPool::Clock;
+
+double ElapsedMs(Clock::time_point since) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+}
+
+// Tests that timed tasks run in due order, never early, while the worker keeps serving other work
+void TestScheduleAfter() {
+  std::cout << "\nTest 1: ScheduleAt / ScheduleAfter\n";
+
+  ThreadPool pool(1);
+  std::mutex order_mutex;
+  std::vector<int> order;
+  std::vector<double> started_ms(4);
+
+  // Every due time is taken from one time point, so the expected order does not depend on scheduling jitter
+  auto start = Clock::now();
+  std::vector<std::shared_ptr<Task<void>>> tasks;
+  for (int delay_ms : {30, 10, 20}) {
+    auto task = std::make_shared<Task<void>>([&, delay_ms]() {
+      std::lock_guard<std::mutex> lock(order_mutex);
+      order.push_back(delay_ms);
+      started_ms[delay_ms / 10] = ElapsedMs(start);
+    });
+    pool.ScheduleAt(start + std::chrono::milliseconds(delay_ms), task);
+    tasks.push_back(task);
+  }
+
+  // ScheduleAfter is measured from its own call
+  auto after_scheduled = Clock::now();
+  double after_ms = 0.0;
+  auto after = std::make_shared<Task<void>>([&]() { after_ms = ElapsedMs(after_scheduled); });
+  pool.ScheduleAfter(15ms, after);
+
+  auto immediate = std::make_shared<Task<void>>([]() {});
+  immediate->TrySchedule(pool);
+  immediate->Wait();
+  double immediate_ms = ElapsedMs(start);
+
+  for (auto& task : tasks) {
+    task->Wait();
+  }
+  after->Wait();
+
+  std::cout << "  Immediate work done after " << immediate_ms << " ms; timers fired at " << started_ms[1] << ", "
+            << started_ms[2] << ", " << started_ms[3] << " ms; ScheduleAfter(15 ms) fired after " << after_ms << " ms\n";
+  assert((order == std::vector<int>{10, 20, 30}));
+  assert(started_ms[1] >= 10.0 && started_ms[2] >= 20.0 && started_ms[3] >= 30.0);
+  assert(after_ms >= 15.0);
+  assert(immediate_ms < started_ms[1]);
+  std::cout << "  PASS\n";
+}
+
+// Tests that ScheduleEvery ticks at a fixed rate and stops once its token is cancelled
+void TestScheduleEvery() {
+  std::cout << "\nTest 2: ScheduleEvery\n";
+
+  ThreadPool pool(1);
+  auto token = MakeCancellationToken();
+  std::atomic<int> ticks{0};
+
+  pool.ScheduleEvery(5ms, [&]() { ticks++; }, token);
+  std::this_thread::sleep_for(60ms);
+  token->Cancel();
+
+  // A tick already handed to the worker may still land; after that the count must stay put
+  std::this_thread::sleep_for(10ms);
+  int after_cancel = ticks;
+  std::this_thread::sleep_for(30ms);
+
+  std::cout << "  Ticks in 60 ms at a 5 ms period: " << after_cancel << "\n";
+  assert(after_cancel >= 3);
+  assert(ticks == after_cancel);
+  std::cout << "  PASS\n";
+}
+
+// Tests that a throwing tick does not stop the timer, and that a timer cancelled from its own tick is not re-armed
+void TestPeriodicFailures() {
+  std::cout << "\nTest 3: Throwing And Self-Cancelling Ticks\n";
+
+  ThreadPool pool(1);
+  auto token = MakeCancellationToken();
+  std::atomic<int> ticks{0};
+
+  pool.ScheduleEvery(2ms, [&]() {
+    if (++ticks == 5) {
+      token->Cancel();
+    }
+    throw std::runtime_error("tick failed");
+  }, token);
+  while (ticks < 5) {
+    std::this_thread::sleep_for(1ms);
+  }
+  std::this_thread::sleep_for(10ms);
+
+  auto report = pool.Shutdown();
+  std::cout << "  Ticks: " << ticks << ", timers left in the heap at shutdown: " << report.timersDiscarded << "\n";
+  assert(ticks == 5);
+  assert(report.timersDiscarded == 0);
+  std::cout << "  PASS\n";
+}
+
+CoroTask<void> DelayedSteps(ThreadPool& pool, std::vector<double>& step_ms, Clock::time_point start) {
+  for (int step = 0; step < 3; ++step) {
+    co_await Delay(pool, 15ms);
+    step_ms.push_back(ElapsedMs(start));
+  }
+}
+
+// Tests co_await Delay: each step waits its delay, and the only worker stays available in between
+void TestDelayAwaiter() {
+  std::cout << "\nTest 4: Delay Awaiter\n";
+
+  ThreadPool pool(1);
+  std::vector<double> step_ms;
+  std::atomic<int> other_jobs{0};
+
+  auto start = Clock::now();
+  auto coro = DelayedSteps(pool, step_ms, start);
+  for (int i = 0; i < 10; ++i) {
+    pool.Enqueue([&]() { other_jobs++; });
+  }
+  while (other_jobs < 10) {
+    std::this_thread::yield();
+  }
+  double other_done_ms = ElapsedMs(start);
+  coro.Wait();
+  coro.rethrow_if_exception();
+
+  std::cout << "  Other jobs done after " << other_done_ms << " ms; steps at " << step_ms[0] << ", " << step_ms[1]
+            << ", " << step_ms[2] << " ms\n";
+  assert(step_ms.size() == 3);
+  assert(step_ms[0] >= 15.0 && step_ms[1] >= 30.0 && step_ms[2] >= 45.0);
+  assert(other_done_ms < step_ms[0]);
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== Timer Scheduling Tests ===\n";
+  TestScheduleAfter();
+  TestScheduleEvery();
+  TestPeriodicFailures();
+  TestDelayAwaiter();
+  std::cout << "\nAll Timer Scheduling tests passed!\n";
+}
+
+}  // namespace TimerDemo
@@ -3,11 +3,15 @@
  * @brief Comprehensive tests for type-safe EventBus API.
  */
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "EventBus.hpp"
 #include "Events.hpp"
@@ -127,12 +131,116 @@ void TestAsyncWithCancellation() {
   std::cout << "  PASS\n";
 }
 
+// Tests sticky events delivering their latest value to late subscribers
+// Shows: SceneLoadedEvent is Sticky, a subscriber added after the load still sees it, hot code reads the slot directly
+void TestStickyLateSubscriber() {
+  std::cout << "\nTest 5: Sticky Event Late Subscriber\n";
+
+  ThreadPool pool(4);
+  auto bus = std::make_shared<EventBus>(pool);
+
+  auto slot = bus->GetStickySlot<SceneLoadedEvent>();
+  assert(slot->Load() == nullptr);
+  assert(bus->GetLatest<SceneLoadedEvent>() == nullptr);
+
+  bus->Emit(SceneLoadedEvent{.scene_name = "Level1", .load_time_ms = 10.0f});
+  bus->Emit(SceneLoadedEvent{.scene_name = "Level2", .load_time_ms = 20.0f});
+
+  std::vector<std::string> seen;
+  auto handle = bus->Subscribe<SceneLoadedEvent>([&](const SceneLoadedEvent& event) { seen.push_back(event.scene_name); });
+  std::cout << "  Late subscriber received: " << (seen.empty() ? "<nothing>" : seen.back()) << " (expected: Level2)\n";
+  assert((seen == std::vector<std::string>{"Level2"}));
+
+  bus->Emit(SceneLoadedEvent{.scene_name = "Level3", .load_time_ms = 30.0f});
+  assert((seen == std::vector<std::string>{"Level2", "Level3"}));
+  assert(slot->Load()->scene_name == "Level3");
+  assert(bus->GetLatest<SceneLoadedEvent>()->scene_name == "Level3");
+
+  // Non-sticky types are unaffected: a late subscriber gets nothing
+  bus->Emit(PlayerDamagedEvent{.player_id = 1, .damage = 5.0f});
+  int damage_calls = 0;
+  auto damage_handle = bus->Subscribe<PlayerDamagedEvent>([&](const PlayerDamagedEvent&) { damage_calls++; });
+  assert(damage_calls == 0);
+  std::cout << "  PASS\n";
+}
+
+// Tests that a subscriber racing an emitter never ends on a value older than the slot, and that lock-free slot reads
+// racing the same emitter only ever move forward
+void TestStickyRacingSubscribers() {
+  std::cout << "\nTest 6: Sticky Catch-Up Racing Emits\n";
+
+  ThreadPool pool(2);
+  auto bus = std::make_shared<EventBus>(pool);
+  auto slot = bus->GetStickySlot<SceneLoadedEvent>();
+  bus->Emit(SceneLoadedEvent{.scene_name = "Level", .load_time_ms = 0.0f});
+
+  constexpr int kSubscribers = 50;
+  std::atomic<bool> subscribing{true};
+  std::atomic<bool> emitting{true};
+  int last_emitted = 0;
+  std::thread emitter([&]() {
+    while (subscribing) {
+      bus->Emit(SceneLoadedEvent{.scene_name = "Level", .load_time_ms = static_cast<float>(++last_emitted)});
+    }
+    emitting = false;
+  });
+
+  std::atomic<bool> reads_in_order{true};
+  std::thread reader([&]() {
+    float last = 0.0f;
+    while (emitting) {
+      float seen = slot->Load()->load_time_ms;
+      if (seen < last) {
+        reads_in_order = false;
+      }
+      last = seen;
+    }
+  });
+
+  // Each subscriber records what it sees; one emitting thread means values must arrive strictly increasing. The first
+  // call (the catch-up value) stalls before recording, giving a dispatch from the emitter every chance to overtake it.
+  struct Seen {
+    std::mutex mutex;
+    std::vector<float> values;
+    std::atomic<bool> first{true};
+  };
+  std::vector<Seen> seen(kSubscribers);
+  std::vector<EventHandle> handles;
+  for (int i = 0; i < kSubscribers; ++i) {
+    handles.push_back(bus->Subscribe<SceneLoadedEvent>([&entry = seen[i]](const SceneLoadedEvent& event) {
+      if (entry.first.exchange(false)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      }
+      std::lock_guard<std::mutex> lock(entry.mutex);
+      entry.values.push_back(event.load_time_ms);
+    }));
+  }
+  subscribing = false;
+  emitter.join();
+  reader.join();
+
+  bool in_order = true;
+  for (const auto& entry : seen) {
+    const auto& values = entry.values;
+    in_order = in_order && !values.empty() && values.back() == static_cast<float>(last_emitted);
+    for (size_t v = 1; v < values.size(); ++v) {
+      in_order = in_order && values[v - 1] < values[v];
+    }
+  }
+  std::cout << "  Subscribers ending on the latest value, in order: " << (in_order ? "all" : "NOT all") << "\n";
+  assert(in_order);
+  assert(reads_in_order);
+  std::cout << "  PASS\n";
+}
+
 void RunAll() {
   std::cout << "\n=== Type-Safe Event Bus Tests ===\n";
   TestTypeSafeBasic();
   TestMultipleEventTypes();
   TestTypeSafeAsync();
   TestAsyncWithCancellation();
+  TestStickyLateSubscriber();
+  TestStickyRacingSubscribers();
   std::cout << "\nAll Type-Safe Event Bus tests passed!\n";
 }
 
@@ -0,0 +1,221 @@
+/**
+ * @file ValueForwardingDemo.cpp
+ * @brief Demonstrates Then(fn) stages that receive their predecessor's result by move, and FuseStages.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Task.hpp"
+#include "TaskExtensions.hpp"
+#include "ThreadPool.hpp"
+
+namespace ValueForwardingDemo {
+
+// Payload that counts how often it is copied
+struct Tracked {
+  static inline std::atomic<int> copies{0};
+
+  std::vector<int> data;
+
+  explicit Tracked(std::vector<int> values) : data(std::move(values)) {
+  }
+  Tracked(const Tracked& other) : data(other.data) {
+    copies++;
+  }
+  Tracked(Tracked&&) noexcept = default;
+  Tracked& operator=(const Tracked&) = delete;
+  Tracked& operator=(Tracked&&) noexcept = default;
+};
+
+// Tests a typed pipeline where every stage consumes the previous result
+void TestPipeline() {
+  std::cout << "\nTest 1: Typed Pipeline\n";
+
+  ThreadPool pool(2);
+  auto source = std::make_shared<Task<int>>([]() { return 21; });
+  auto text = source->Then([](int value) { return std::to_string(value * 2); });
+  auto length = text->Then([](std::string value) { return value.size() + 40; });
+  std::atomic<size_t> seen{0};
+  auto sink = length->Then([&](size_t value) { seen = value; });
+
+  source->TrySchedule(pool);
+  sink->Wait();
+
+  assert(seen == 42);
+  assert(text->IsDone() && length->IsDone());  // their results were moved on, so GetResult would throw
+  std::cout << "  21 -> \"42\" -> 42\n";
+  std::cout << "  PASS\n";
+}
+
+// Tests that results travel between stages by move only, including move-only results
+void TestNoCopies() {
+  std::cout << "\nTest 2: No Copies\n";
+
+  ThreadPool pool(2);
+  Tracked::copies = 0;
+  auto load = std::make_shared<Task<Tracked>>([]() { return Tracked({1, 2, 3, 4}); });
+  auto doubled = load->Then([](Tracked value) {
+    for (int& x : value.data) {
+      x *= 2;
+    }
+    return value;
+  });
+  auto sum = doubled->Then([](Tracked&& value) {
+    int total = 0;
+    for (int x : value.data) {
+      total += x;
+    }
+    return total;
+  });
+
+  auto owned = std::make_shared<Task<std::unique_ptr<int>>>([]() { return std::make_unique<int>(7); });
+  auto unwrapped = owned->Then([](std::unique_ptr<int> value) { return *value; });
+
+  load->TrySchedule(pool);
+  owned->TrySchedule(pool);
+  sum->Wait();
+  unwrapped->Wait();
+
+  std::cout << "  sum " << sum->GetResult() << ", copies " << Tracked::copies << "\n";
+  assert(sum->GetResult() == 20 && Tracked::copies == 0);
+  assert(unwrapped->GetResult() == 7);
+
+  // A second stage on a move-only result fails: the value already went to the first one
+  auto again = owned->Then([](std::unique_ptr<int> value) { return *value; });
+  again->Finally(std::make_shared<Task<void>>([]() {}))->Wait();
+  bool failed = false;
+  try {
+    again->GetResult();
+  } catch (const std::logic_error&) {
+    failed = true;
+  }
+  assert(failed);
+  std::cout << "  PASS\n";
+}
+
+// Tests that a failing stage skips the following ones and its exception reaches the end of the chain
+void TestFailure() {
+  std::cout << "\nTest 3: Failure\n";
+
+  ThreadPool pool(1);
+  std::atomic<bool> later_ran{false};
+  auto parse = std::make_shared<Task<std::string>>([]() { return std::string("not a number"); });
+  auto number = parse->Then([](std::string text) { return std::stoi(text); });
+  auto scaled = number->Then([&](int value) {
+    later_ran = true;
+    return value * 2;
+  });
+  auto settled = scaled->Finally(std::make_shared<Task<void>>([]() {}));
+
+  parse->TrySchedule(pool);
+  settled->Wait();
+
+  bool caught = false;
+  try {
+    scaled->GetResult();
+  } catch (const std::invalid_argument&) {
+    caught = true;
+  }
+  assert(caught && !later_ran);
+  std::cout << "  stoi failure reached the last stage\n";
+  std::cout << "  PASS\n";
+}
+
+// Tests fan-out: every stage but the last gets a copy, and the predecessor's result is consumed
+void TestFanOut() {
+  std::cout << "\nTest 4: Fan-Out\n";
+
+  ThreadPool pool(2);
+  Tracked::copies = 0;
+  auto source = std::make_shared<Task<Tracked>>([]() { return Tracked({5, 5}); });
+  auto first = source->Then([](Tracked value) { return value.data.size(); });
+  auto second = source->Then([](Tracked value) { return value.data[0]; });
+  auto gate = std::make_shared<Task<void>>([]() {});
+  first->Then(gate);
+  second->Then(gate);
+
+  source->TrySchedule(pool);
+  gate->Wait();
+  assert(first->GetResult() == 2 && second->GetResult() == 5);
+  assert(Tracked::copies == 1);
+
+  bool consumed = false;
+  try {
+    source->GetResult();
+  } catch (const std::logic_error&) {
+    consumed = true;
+  }
+  assert(consumed);
+
+  auto late = source->Then([](Tracked value) { return value.data.size(); });
+  late->Finally(std::make_shared<Task<void>>([]() {}))->Wait();
+  bool late_failed = false;
+  try {
+    late->GetResult();
+  } catch (const std::logic_error&) {
+    late_failed = true;
+  }
+  assert(late_failed);
+  std::cout << "  2 stages, 1 copy; a stage attached after the result was consumed fails\n";
+  std::cout << "  PASS\n";
+}
+
+// Tests FuseStages and compares a fused chain against the same stages as separate tasks
+void TestFuseStages() {
+  std::cout << "\nTest 5: Fuse Stages\n";
+
+  ThreadPool pool(1);
+  std::atomic<int> side_effect{0};
+  auto fused = FuseStages([]() { return 3; }, [](int value) { return value * 7; },
+                          [&](int value) { side_effect = value; }, []() { return std::string("done"); });
+  fused->TrySchedule(pool);
+  fused->Wait();
+  assert(side_effect == 21 && fused->GetResult() == "done");
+
+  constexpr int kChains = 2000;
+  auto time_chains = [&](bool fuse) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::shared_ptr<Task<int>>> ends;
+    ends.reserve(kChains);
+    for (int i = 0; i < kChains; ++i) {
+      auto add = [](int value) { return value + 1; };
+      if (fuse) {
+        auto task = FuseStages([i]() { return i; }, add, add, add);
+        task->TrySchedule(pool);
+        ends.push_back(task);
+      } else {
+        auto head = std::make_shared<Task<int>>([i]() { return i; });
+        ends.push_back(head->Then(add)->Then(add)->Then(add));
+        head->TrySchedule(pool);
+      }
+    }
+    for (int i = 0; i < kChains; ++i) {
+      ends[i]->Wait();
+      assert(ends[i]->GetResult() == i + 3);
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  };
+  double chained_ms = time_chains(false);
+  double fused_ms = time_chains(true);
+  std::cout << "  " << kChains << " four-stage chains: Then " << chained_ms << " ms, fused " << fused_ms << " ms\n";
+  std::cout << "  PASS\n";
+}
+
+void RunAll() {
+  std::cout << "\n=== Value Forwarding Tests ===\n";
+  TestPipeline();
+  TestNoCopies();
+  TestFailure();
+  TestFanOut();
+  TestFuseStages();
+  std::cout << "\nAll Value Forwarding tests passed!\n";
+}
+
+}  // namespace ValueForwardingDemo
@@ -0,0 +1,24 @@
+/**
+ * @file CacheLine.hpp
+ * @brief Cache line size used to keep independently written hot state on separate lines.
+ * @details Uses std::hardware_destructive_interference_size where it is a stable constant (MSVC).
+ *          GCC and Clang warn that the value may change with -mtune, so a fixed 64 bytes is used there.
+ *
+ * @code{.cpp}
+ * struct Counters {
+ *   alignas(kCacheLineSize) std::atomic<int> written_by_producers{0};
+ *   alignas(kCacheLineSize) std::atomic<bool> read_by_consumers{false};
+ * };
+ * @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+#if defined(__cpp_lib_hardware_interference_size) && !defined(__GNUC__)
+inline constexpr size_t kCacheLineSize = std::hardware_destructive_interference_size;
+#else
+inline constexpr size_t kCacheLineSize = 64;
+#endif
@@ -2,16 +2,20 @@
  * @file CancellationToken.hpp
  * @brief Lightweight cancellation token to signal and observe cancellation.
  * @details Provides cancellation signaling, callback registration, and exception support via TaskCancelledException.
- * @note Use callbacks to react to cancellation
+ * @note Use callbacks to react to cancellation; unregister them when the operation they guard completes first
  */
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <vector>
 
+#include "CacheLine.hpp"
+
 class TaskCancelledException : public std::exception {
  public:
   const char* what() const noexcept override {
@@ -21,17 +25,26 @@ class TaskCancelledException : public std::exception {
 
 class CancellationToken {
  public:
+  using CallbackId = uint64_t;
+
+  // Returned by RegisterCallback when the callback already ran because the token was cancelled
+  static constexpr CallbackId kNoCallback = 0;
+
   CancellationToken() = default;
 
+  // Callbacks run outside the registration lock, so a callback may itself register or cancel
   void Cancel() {
     if (!is_cancelled_.exchange(true, std::memory_order_acq_rel)) {
-      std::lock_guard<std::mutex> lock(callbacks_mutex_);
-      for (auto& callback : callbacks_) {
-        if (callback) {
-          callback();
+      std::vector<Registration> callbacks;
+      {
+        std::lock_guard<std::mutex> lock(callbacks_mutex_);
+        callbacks.swap(callbacks_);
+      }
+      for (auto& registration : callbacks) {
+        if (registration.callback) {
+          registration.callback();
         }
       }
-      callbacks_.clear();
     }
   }
 
@@ -45,19 +58,46 @@ class CancellationToken {
     }
   }
 
-  void RegisterCallback(std::function<void()> callback) {
+  // Runs callback exactly once: now if already cancelled (returning kNoCallback), otherwise from Cancel
+  CallbackId RegisterCallback(std::function<void()> callback) {
+    {
+      std::lock_guard<std::mutex> lock(callbacks_mutex_);
+      if (!IsCancelled()) {
+        CallbackId id = ++next_callback_id_;
+        callbacks_.push_back(Registration{id, std::move(callback)});
+        return id;
+      }
+    }
+    callback();
+    return kNoCallback;
+  }
+
+  /**
+   * @brief Drops a callback that has not run yet
+   * @return true if it was removed and will never run; false if Cancel already took it, in which case it may still be
+   *         running on the cancelling thread
+   */
+  bool UnregisterCallback(CallbackId id) {
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
-    if (IsCancelled()) {
-      callback();
-    } else {
-      callbacks_.push_back(std::move(callback));
+    auto it = std::find_if(callbacks_.begin(), callbacks_.end(), [id](const Registration& r) { return r.id == id; });
+    if (it == callbacks_.end()) {
+      return false;
     }
+    callbacks_.erase(it);
+    return true;
   }
 
  private:
-  std::atomic<bool> is_cancelled_{false};
-  std::mutex callbacks_mutex_;
-  std::vector<std::function<void()>> callbacks_;
+  struct Registration {
+    CallbackId id;
+    std::function<void()> callback;
+  };
+
+  // Polled by every handler dispatch; kept apart from the registration lock
+  alignas(kCacheLineSize) std::atomic<bool> is_cancelled_{false};
+  alignas(kCacheLineSize) std::mutex callbacks_mutex_;
+  std::vector<Registration> callbacks_;
+  CallbackId next_callback_id_ = kNoCallback;
 };
 
 using CancellationTokenPtr = std::shared_ptr<CancellationToken>;
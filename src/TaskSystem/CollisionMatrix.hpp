@@ -0,0 +1,123 @@
+/**
+ * @file CollisionMatrix.hpp
+ * @brief Category-pair collision filter with a batch path that filters whole contact lists without a branch per pair.
+ * @details Row a is a 16-bit mask whose bit b says whether category a collides with category b. The matrix is not
+ *          symmetric: SetFilter(a, b) leaves (b, a) untouched. The 16-category limit exists so each row fits one
+ *          shuffle lane.
+ *          FilterBatch checks 16 pairs per step on SSSE3: pshufb looks up the low and high byte of each pair's row
+ *          by category a and the matching bit by category b, movemask turns the result into one bit per pair, and
+ *          the set bits are written out as indices. Without SSSE3 the same loop runs scalar, still without a branch
+ *          per pair. Categories >= kMaxCategories never collide.
+ *
+ * @code{.cpp}
+ * size_t passing = matrix.FilterBatch(std::span(frame.category_a), std::span(frame.category_b), std::span(indices));
+ * for (uint32_t i : std::span(indices).first(passing)) { ... }
+ * @endcode
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__SSSE3__) || defined(_M_X64)
+#include <tmmintrin.h>
+#define TASKSYSTEM_COLLISION_MATRIX_SSSE3 1
+#endif
+
+class CollisionMatrix {
+ public:
+  static constexpr size_t kMaxCategories = 16;
+
+  void SetFilter(uint8_t a, uint8_t b, bool enabled) {
+    if (a >= kMaxCategories || b >= kMaxCategories) {
+      throw std::out_of_range("CollisionMatrix supports at most 16 categories");
+    }
+    rows_[a] = static_cast<uint16_t>(enabled ? rows_[a] | (1u << b) : rows_[a] & ~(1u << b));
+    row_lo_[a] = static_cast<uint8_t>(rows_[a]);
+    row_hi_[a] = static_cast<uint8_t>(rows_[a] >> 8);
+  }
+
+  bool ShouldCollide(uint8_t a, uint8_t b) const {
+    return ((a | b) < kMaxCategories) & (rows_[a & 15] >> (b & 15)) & 1;
+  }
+
+  /**
+   * @brief Writes the index of every pair i with ShouldCollide(a[i], b[i]) to passing, in increasing order
+   * @param passing Must have room for count indices
+   * @return How many indices were written
+   */
+  size_t FilterBatch(const uint8_t* a, const uint8_t* b, size_t count, uint32_t* passing) const {
+    size_t written = 0;
+    size_t i = 0;
+#if defined(TASKSYSTEM_COLLISION_MATRIX_SSSE3)
+    const __m128i row_lo = _mm_load_si128(reinterpret_cast<const __m128i*>(row_lo_.data()));
+    const __m128i row_hi = _mm_load_si128(reinterpret_cast<const __m128i*>(row_hi_.data()));
+    const __m128i bit_lo = _mm_load_si128(reinterpret_cast<const __m128i*>(kBitLo.data()));
+    const __m128i bit_hi = _mm_load_si128(reinterpret_cast<const __m128i*>(kBitHi.data()));
+    const __m128i high_nibble = _mm_set1_epi8(static_cast<char>(0xF0));
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+      __m128i cat_a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+      __m128i cat_b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+      __m128i in_range = _mm_cmpeq_epi8(_mm_and_si128(_mm_or_si128(cat_a, cat_b), high_nibble), zero);
+      // pshufb only reads the low nibble (or yields 0 for bytes >= 0x80); out-of-range lanes are masked off below
+      __m128i hit = _mm_or_si128(_mm_and_si128(_mm_shuffle_epi8(row_lo, cat_a), _mm_shuffle_epi8(bit_lo, cat_b)),
+                                 _mm_and_si128(_mm_shuffle_epi8(row_hi, cat_a), _mm_shuffle_epi8(bit_hi, cat_b)));
+      unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(in_range)) &
+                      ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(hit, zero))) & 0xFFFFu;
+      while (mask != 0) {
+        passing[written++] = static_cast<uint32_t>(i + std::countr_zero(mask));
+        mask &= mask - 1;
+      }
+    }
+#endif
+    for (; i < count; ++i) {
+      passing[written] = static_cast<uint32_t>(i);
+      written += ShouldCollide(a[i], b[i]);
+    }
+    return written;
+  }
+
+  size_t FilterBatch(std::span<const uint8_t> a, std::span<const uint8_t> b, std::span<uint32_t> passing) const {
+    if (a.size() != b.size() || passing.size() < a.size()) {
+      throw std::invalid_argument("FilterBatch: category spans differ in size or passing is too small");
+    }
+    return FilterBatch(a.data(), b.data(), a.size(), passing.data());
+  }
+
+  // Overloads for one-byte category enums such as EntityCategory
+  template <typename Category>
+    requires std::is_enum_v<Category> && (sizeof(Category) == 1)
+  void SetFilter(Category a, Category b, bool enabled) {
+    SetFilter(static_cast<uint8_t>(a), static_cast<uint8_t>(b), enabled);
+  }
+
+  template <typename Category>
+    requires std::is_enum_v<Category> && (sizeof(Category) == 1)
+  bool ShouldCollide(Category a, Category b) const {
+    return ShouldCollide(static_cast<uint8_t>(a), static_cast<uint8_t>(b));
+  }
+
+  template <typename Category>
+    requires std::is_enum_v<std::remove_const_t<Category>> && (sizeof(Category) == 1)
+  size_t FilterBatch(std::span<Category> a, std::span<Category> b, std::span<uint32_t> passing) const {
+    // A one-byte enum has the object representation of its underlying type, which may be read as unsigned char
+    return FilterBatch(std::span(reinterpret_cast<const uint8_t*>(a.data()), a.size()),
+                       std::span(reinterpret_cast<const uint8_t*>(b.data()), b.size()), passing);
+  }
+
+ private:
+  // kBitLo[b] selects b's bit in the low byte of a row, kBitHi[b] in the high byte
+  alignas(16) static constexpr std::array<uint8_t, 16> kBitLo = {1, 2, 4, 8, 16, 32, 64, 128, 0, 0, 0, 0, 0, 0, 0, 0};
+  alignas(16) static constexpr std::array<uint8_t, 16> kBitHi = {0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, 128};
+
+  std::array<uint16_t, kMaxCategories> rows_{};
+  alignas(16) std::array<uint8_t, kMaxCategories> row_lo_{};
+  alignas(16) std::array<uint8_t, kMaxCategories> row_hi_{};
+};
@@ -2,7 +2,7 @@
  * @file CoroTask.hpp
  * @brief Minimal coroutine wrapper that supports waiting and exception propagation.
  * @details Defines a simple coroutine task type that allows waiting for completion and rethrowing exceptions.
- * @note final_suspend notifies waiting threads
+ * @note final_suspend notifies waiting threads once the coroutine is suspended for good
  */
 
 #pragma once
@@ -24,15 +24,28 @@ struct CoroTask {
       return CoroTask{std::coroutine_handle<promise_type>::from_promise(*this)};
     }
 
+    // Completion is published only once the coroutine is suspended at its final point, so a waiter that destroys
+    // the frame right after Wait returns cannot race with the coroutine still finishing on another thread
+    struct FinalAwaiter {
+      bool await_ready() noexcept {
+        return false;
+      }
+
+      void await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+        promise_type& promise = handle.promise();
+        std::lock_guard<std::mutex> lock(promise.wait_mutex_);
+        promise.is_done_ = true;
+        promise.wait_cv_.notify_all();  // under the lock: the frame may be destroyed as soon as it is released
+      }
+
+      void await_resume() noexcept {
+      }
+    };
+
     std::suspend_never initial_suspend() {
       return {};
     }
-    std::suspend_always final_suspend() noexcept {
-      {
-        std::lock_guard<std::mutex> lock(wait_mutex_);
-        is_done_ = true;
-      }
-      wait_cv_.notify_all();
+    FinalAwaiter final_suspend() noexcept {
       return {};
     }
 
@@ -0,0 +1,42 @@
+/**
+ * @file DelayAwaiter.hpp
+ * @brief Coroutine awaiter that suspends for a duration without occupying a pool worker.
+ * @details The coroutine is parked on the pool's timer heap (ThreadPool::EnqueueAfter) and resumed on a pool worker
+ *          once the delay has passed, so a waiting coroutine costs a heap entry instead of a sleeping thread.
+ * @note A non-positive delay completes without suspending
+ * @note If the pool is destroyed before the delay elapses the coroutine is never resumed
+ *
+ * @code{.cpp}
+ * CoroTask<void> Blink(ThreadPool& pool) {
+ *   co_await Delay(pool, std::chrono::milliseconds(50));
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <chrono>
+#include <coroutine>
+
+#include "ThreadPool.hpp"
+
+struct DelayAwaiter {
+  ThreadPool& pool;
+  ThreadPool::Clock::duration delay;
+
+  bool await_ready() const {
+    return delay <= ThreadPool::Clock::duration::zero();
+  }
+
+  void await_suspend(std::coroutine_handle<> awaiting_coro) {
+    pool.EnqueueAfter(delay, [awaiting_coro]() { awaiting_coro.resume(); });
+  }
+
+  void await_resume() const {
+  }
+};
+
+template <typename Rep, typename Period>
+DelayAwaiter Delay(ThreadPool& pool, std::chrono::duration<Rep, Period> delay) {
+  return DelayAwaiter{pool, std::chrono::duration_cast<ThreadPool::Clock::duration>(delay)};
+}
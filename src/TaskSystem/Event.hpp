@@ -17,17 +17,57 @@
  */
 #pragma once
 
+#include <concepts>
+#include <cstdint>
+#include <functional>
 #include <string_view>
 #include <type_traits>
 
+// FNV-1a 64-bit; stable across builds and processes, unlike std::type_index
+constexpr uint64_t HashEventName(std::string_view name) {
+  uint64_t hash = 14695981039346656037ull;
+  for (char c : name) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
 template <typename Derived>
 struct Event {
   static constexpr std::string_view GetEventName() {
     return Derived::EventName;
   }
+
+  // Identifies the event type in recorded logs and cross-process transports
+  static constexpr uint64_t GetEventId() {
+    return HashEventName(Derived::EventName);
+  }
 };
 
 template <typename T>
 concept EventType = requires {
   { T::EventName } -> std::convertible_to<std::string_view>;
 } && std::is_base_of_v<Event<T>, T>;
+
+// Opt-in for EventBus::PublishAsyncSingleFlight: identical in-flight publishes share one dispatch
+template <typename T>
+concept SingleFlightEvent = EventType<T> && requires(const T& event) {
+  { std::hash<std::decay_t<decltype(event.SingleFlightKey())>>{}(event.SingleFlightKey()) } -> std::convertible_to<size_t>;
+  { event.SingleFlightKey() == event.SingleFlightKey() } -> std::convertible_to<bool>;
+};
+
+// Specialize with `static constexpr auto Fields = std::make_tuple(&E::a, &E::b, ...)` to opt E into
+// structure-of-arrays batch delivery (EventBus::SubscribeBatch / EmitDeferred / FlushBatches)
+template <typename T>
+struct BatchLayout;
+
+template <typename T>
+concept BatchableEvent = EventType<T> && requires { BatchLayout<T>::Fields; };
+
+// Opt-in for sticky delivery with `static constexpr bool Sticky = true;`: the bus keeps the last emitted value,
+// hands it to new subscribers at subscribe time and exposes it through EventBus::GetLatest
+template <typename T>
+concept StickyEvent = EventType<T> && std::copy_constructible<T> && requires {
+  requires T::Sticky;
+};
@@ -0,0 +1,109 @@
+/**
+ * @file EventBatch.hpp
+ * @brief Structure-of-arrays storage for batches of plain-data events.
+ * @details EventBatch<E> keeps one contiguous column per field listed in BatchLayout<E>::Fields.
+ *          Batch handlers read whole columns as spans and can process a frame's worth of events with
+ *          vectorisable loops instead of one type-erased call per event.
+ * @note Columns are only valid for the duration of the batch handler call
+ *
+ * @code{.cpp}
+ * template <>
+ * struct BatchLayout<PlayerDamagedEvent> {
+ *   static constexpr auto Fields = std::make_tuple(&PlayerDamagedEvent::player_id, &PlayerDamagedEvent::damage);
+ * };
+ *
+ * bus->SubscribeBatch<PlayerDamagedEvent>([](const EventBatch<PlayerDamagedEvent>& batch) {
+ *   std::span<const float> damage = batch.Column<&PlayerDamagedEvent::damage>();
+ *   float total = 0.0f;
+ *   for (float d : damage) total += d;
+ * });
+ * @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Event.hpp"
+
+namespace detail {
+
+template <typename M>
+struct MemberPointerTraits;
+
+template <typename C, typename T>
+struct MemberPointerTraits<T C::*> {
+  using Type = T;
+};
+
+template <typename Fields>
+struct BatchColumns;
+
+template <typename... MemberPointers>
+struct BatchColumns<std::tuple<MemberPointers...>> {
+  using Type = std::tuple<std::vector<typename MemberPointerTraits<MemberPointers>::Type>...>;
+};
+
+}  // namespace detail
+
+template <typename E>
+  requires BatchableEvent<E>
+class EventBatch {
+  using Fields = std::remove_cv_t<decltype(BatchLayout<E>::Fields)>;
+  static constexpr size_t kFieldCount = std::tuple_size_v<Fields>;
+
+ public:
+  size_t Size() const {
+    return std::get<0>(columns_).size();
+  }
+
+  bool Empty() const {
+    return Size() == 0;
+  }
+
+  // Contiguous view of one field across every event in the batch
+  template <auto Member>
+  std::span<const typename detail::MemberPointerTraits<decltype(Member)>::Type> Column() const {
+    return std::get<FieldIndex<Member>()>(columns_);
+  }
+
+  void Push(const E& event) {
+    PushFields(event, std::make_index_sequence<kFieldCount>{});
+  }
+
+  void Reserve(size_t count) {
+    std::apply([count](auto&... column) { (column.reserve(count), ...); }, columns_);
+  }
+
+  // Keeps column capacity so a recycled batch does not reallocate
+  void Clear() {
+    std::apply([](auto&... column) { (column.clear(), ...); }, columns_);
+  }
+
+ private:
+  template <size_t... I>
+  void PushFields(const E& event, std::index_sequence<I...>) {
+    (std::get<I>(columns_).push_back(event.*std::get<I>(BatchLayout<E>::Fields)), ...);
+  }
+
+  template <auto Member, size_t I = 0>
+  static constexpr size_t FieldIndex() {
+    static_assert(I < kFieldCount, "Member is not listed in BatchLayout<E>::Fields");
+    if constexpr (std::is_same_v<std::tuple_element_t<I, Fields>, decltype(Member)>) {
+      if constexpr (std::get<I>(BatchLayout<E>::Fields) == Member) {
+        return I;
+      } else {
+        return FieldIndex<Member, I + 1>();
+      }
+    } else {
+      return FieldIndex<Member, I + 1>();
+    }
+  }
+
+  typename detail::BatchColumns<Fields>::Type columns_;
+};
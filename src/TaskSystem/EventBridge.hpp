@@ -0,0 +1,143 @@
+/**
+ * @file EventBridge.hpp
+ * @brief Bridges EventBus instances across processes over a shared-memory SpscRing.
+ * @details EventBridgeSender serializes events (EventSerialization) into `[event id][payload]` frames and pushes them
+ *          into the ring; Forward<E> subscribes to a local bus so every Emit of E crosses the bridge automatically.
+ *          EventBridgeReceiver pops frames, decodes registered types and re-emits them on its own bus from Poll,
+ *          so handlers on the receiving side run on the polling thread.
+ * @note The ring has a single producer; the sender serializes concurrent emitters with a mutex
+ * @note A full ring drops the event instead of blocking the emitter; see GetDroppedCount
+ *
+ * @code{.cpp}
+ * // Simulation process
+ * auto region = SharedMemoryRegion::Create("sim-to-tools", SpscRing::RequiredBytes(1 << 20));
+ * EventBridgeSender sender(SpscRing::Initialize(region.Data(), region.Size()));
+ * sender.Forward<PlayerDamagedEvent>(*sim_bus);
+ *
+ * // Tooling process
+ * auto view = SharedMemoryRegion::Open("sim-to-tools", SpscRing::RequiredBytes(1 << 20));
+ * EventBridgeReceiver receiver(SpscRing::Attach(view.Data()));
+ * receiver.Register<PlayerDamagedEvent>();
+ * receiver.Poll(*tools_bus);  // once per tick
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "Event.hpp"
+#include "EventBus.hpp"
+#include "EventSerialization.hpp"
+#include "SpscRing.hpp"
+
+class EventBridgeSender {
+ public:
+  explicit EventBridgeSender(SpscRing ring) : ring_(ring) {
+  }
+
+  // Serializes and pushes one event; returns false (and counts a drop) when the ring is full
+  template <typename E>
+    requires SerializableEvent<E>
+  bool Send(const E& event) {
+    std::lock_guard<std::mutex> lock(send_mutex_);
+    frame_.clear();
+    ByteWriter writer(frame_);
+    writer.WritePod(E::GetEventId());
+    SerializeEvent(event, frame_);
+
+    if (!ring_.TryPush(frame_.data(), frame_.size())) {
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    sent_count_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Forwards every broadcast Emit of E on bus for as long as this sender lives
+  template <typename E>
+    requires SerializableEvent<E>
+  void Forward(EventBus& bus) {
+    handles_.push_back(bus.Subscribe<E>([this](const E& event) { Send(event); }));
+  }
+
+  uint64_t GetSentCount() const {
+    return sent_count_.load(std::memory_order_relaxed);
+  }
+
+  uint64_t GetDroppedCount() const {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
+  EventBridgeSender(const EventBridgeSender&) = delete;
+  EventBridgeSender& operator=(const EventBridgeSender&) = delete;
+
+ private:
+  SpscRing ring_;
+  std::mutex send_mutex_;
+  std::vector<std::byte> frame_;  // reused under send_mutex_
+  std::vector<EventHandle> handles_;
+  std::atomic<uint64_t> sent_count_{0};
+  std::atomic<uint64_t> dropped_count_{0};
+};
+
+class EventBridgeReceiver {
+ public:
+  explicit EventBridgeReceiver(SpscRing ring) : ring_(ring) {
+  }
+
+  template <typename E>
+    requires SerializableEvent<E> && std::is_default_constructible_v<E>
+  void Register() {
+    decoders_[E::GetEventId()] = [](EventBus& bus, std::span<const std::byte> payload) {
+      E event{};
+      if (!DeserializeEvent(payload, event)) {
+        return false;
+      }
+      bus.Emit(event);
+      return true;
+    };
+  }
+
+  // Emits up to max_events pending events on bus; returns how many were emitted
+  size_t Poll(EventBus& bus, size_t max_events = SIZE_MAX) {
+    size_t emitted = 0;
+    while (emitted < max_events && ring_.TryPop(frame_)) {
+      uint64_t event_id = 0;
+      if (frame_.size() < sizeof(event_id)) {
+        ++skipped_count_;
+        continue;
+      }
+      std::memcpy(&event_id, frame_.data(), sizeof(event_id));
+
+      auto it = decoders_.find(event_id);
+      if (it == decoders_.end() || !it->second(bus, std::span<const std::byte>(frame_).subspan(sizeof(event_id)))) {
+        ++skipped_count_;
+        continue;
+      }
+      ++emitted;
+    }
+    return emitted;
+  }
+
+  // Frames of unregistered types or with undecodable payloads
+  uint64_t GetSkippedCount() const {
+    return skipped_count_;
+  }
+
+ private:
+  using Decoder = bool (*)(EventBus&, std::span<const std::byte>);
+
+  SpscRing ring_;
+  std::vector<std::byte> frame_;
+  std::unordered_map<uint64_t, Decoder> decoders_;
+  uint64_t skipped_count_ = 0;
+};
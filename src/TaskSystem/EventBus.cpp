@@ -5,24 +5,94 @@
 
 #include "EventBus.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
 void EventHandle::Unsubscribe() {
   if (unsubscribed_) {
     return;
   }
 
   if (auto bus = bus_.lock()) {
-    if (target_.has_value()) {
-      bus->UnsubscribeTargeted(event_type_, target_.value(), handler_id_);
-    } else {
-      bus->Unsubscribe(event_type_, handler_id_);
+    switch (kind_) {
+      case SubscriptionKind::Broadcast:
+        bus->Unsubscribe(event_type_, handler_id_);
+        break;
+      case SubscriptionKind::Targeted:
+        bus->UnsubscribeTargeted(event_type_, target_.value(), handler_id_);
+        break;
+      case SubscriptionKind::Batch:
+        bus->UnsubscribeBatch(event_type_, handler_id_);
+        break;
+      case SubscriptionKind::Topic:
+        bus->UnsubscribeTopic(handler_id_);
+        break;
     }
   }
 
   unsubscribed_ = true;
 }
 
+void EventHandle::Retire() {
+  if (unsubscribed_) {
+    return;
+  }
+
+  if (auto bus = bus_.lock()) {
+    bus->Retire(EventBus::RetiredSubscription{kind_, event_type_, handler_id_, target_});
+  }
+
+  unsubscribed_ = true;
+}
+
+void EventHandle::RetireAll(std::vector<EventHandle>& handles) {
+  // A scope rarely spans more than a couple of buses, so a linear scan beats a map here
+  std::vector<std::pair<std::shared_ptr<EventBus>, std::vector<EventBus::RetiredSubscription>>> groups;
+  for (auto& handle : handles) {
+    if (handle.unsubscribed_) {
+      continue;
+    }
+    handle.unsubscribed_ = true;
+
+    auto bus = handle.bus_.lock();
+    if (!bus) {
+      continue;
+    }
+    auto group = std::find_if(groups.begin(), groups.end(), [&bus](const auto& entry) { return entry.first == bus; });
+    if (group == groups.end()) {
+      group = groups.emplace(groups.end(), std::move(bus), std::vector<EventBus::RetiredSubscription>{});
+    }
+    group->second.push_back(EventBus::RetiredSubscription{handle.kind_, handle.event_type_, handle.handler_id_, handle.target_});
+  }
+
+  for (auto& [bus, subscriptions] : groups) {
+    bus->RetireAll(std::move(subscriptions));
+  }
+}
+
 void EventBus::Unsubscribe(std::type_index event_type, uint64_t handler_id) {
-  std::unique_lock<std::mutex> lock(handlers_mutex_);
+  auto lock = LockHandlers();
+  EraseHandler(event_type, handler_id);
+}
+
+void EventBus::UnsubscribeTargeted(std::type_index event_type, SubjectID target, uint64_t handler_id) {
+  auto lock = LockHandlers();
+  EraseTargetedHandler(event_type, target, handler_id);
+}
+
+void EventBus::UnsubscribeBatch(std::type_index event_type, uint64_t handler_id) {
+  auto lock = LockHandlers();
+  EraseBatchHandler(event_type, handler_id);
+}
+
+void EventBus::UnsubscribeTopic(uint64_t handler_id) {
+  auto lock = LockHandlers();
+  EraseTopicHandler(handler_id);
+}
+
+void EventBus::EraseHandler(std::type_index event_type, uint64_t handler_id) {
+  broadcast_snapshots_.erase(event_type);
   auto event_it = event_handlers_.find(event_type);
   if (event_it != event_handlers_.end()) {
     event_it->second.erase(handler_id);
@@ -32,8 +102,8 @@ void EventBus::Unsubscribe(std::type_index event_type, uint64_t handler_id) {
   }
 }
 
-void EventBus::UnsubscribeTargeted(std::type_index event_type, SubjectID target, uint64_t handler_id) {
-  std::unique_lock<std::mutex> lock(handlers_mutex_);
+void EventBus::EraseTargetedHandler(std::type_index event_type, SubjectID target, uint64_t handler_id) {
+  InvalidateTargetedSnapshot(event_type, target);
   auto event_it = targeted_handlers_.find(event_type);
   if (event_it != targeted_handlers_.end()) {
     auto target_it = event_it->second.find(target);
@@ -49,3 +119,160 @@ void EventBus::UnsubscribeTargeted(std::type_index event_type, SubjectID target,
     }
   }
 }
+
+void EventBus::EraseBatchHandler(std::type_index event_type, uint64_t handler_id) {
+  auto event_it = batch_handlers_.find(event_type);
+  if (event_it != batch_handlers_.end()) {
+    event_it->second.erase(handler_id);
+    if (event_it->second.empty()) {
+      batch_handlers_.erase(event_it);
+    }
+  }
+}
+
+void EventBus::EraseTopicHandler(uint64_t handler_id) {
+  auto it = topic_subscriptions_.find(handler_id);
+  if (it != topic_subscriptions_.end()) {
+    topic_trie_.Remove(it->second.pattern, handler_id);
+    topic_subscriptions_.erase(it);
+    resolved_topics_.clear();
+    broadcast_snapshots_.clear();
+  }
+}
+
+void EventBus::InvalidateTargetedSnapshot(std::type_index event_type, SubjectID target) {
+  auto event_it = targeted_snapshots_.find(event_type);
+  if (event_it != targeted_snapshots_.end()) {
+    event_it->second.erase(target);
+    if (event_it->second.empty()) {
+      targeted_snapshots_.erase(event_it);
+    }
+  }
+}
+
+std::shared_ptr<const EventBus::HandlerSnapshot> EventBus::TargetedSnapshot(std::type_index event_type, SubjectID target) {
+  // Targets without subscribers share one empty list so emitting to arbitrary subjects does not grow the cache
+  static const auto kNoHandlers = std::make_shared<const HandlerSnapshot>();
+
+  auto event_it = targeted_handlers_.find(event_type);
+  if (event_it == targeted_handlers_.end()) {
+    return kNoHandlers;
+  }
+  auto target_it = event_it->second.find(target);
+  if (target_it == event_it->second.end()) {
+    return kNoHandlers;
+  }
+
+  auto& cached = targeted_snapshots_[event_type][target];
+  if (!cached) {
+    auto snapshot = std::make_shared<HandlerSnapshot>();
+    snapshot->reserve(target_it->second.size());
+    for (const auto& [id, handler] : target_it->second) {
+      snapshot->push_back(handler);
+    }
+    cached = std::move(snapshot);
+  }
+  return cached;
+}
+
+void EventBus::Retire(RetiredSubscription subscription) {
+  std::lock_guard<std::mutex> lock(retired_mutex_);
+  retired_.push_back(std::move(subscription));
+  has_retired_.store(true, std::memory_order_release);
+}
+
+void EventBus::RetireAll(std::vector<RetiredSubscription>&& subscriptions) {
+  if (subscriptions.empty()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(retired_mutex_);
+  if (retired_.empty()) {
+    retired_ = std::move(subscriptions);
+  } else {
+    retired_.insert(retired_.end(), std::make_move_iterator(subscriptions.begin()), std::make_move_iterator(subscriptions.end()));
+  }
+  has_retired_.store(true, std::memory_order_release);
+}
+
+void EventBus::DrainRetired() {
+  std::vector<RetiredSubscription> retired;
+  {
+    std::lock_guard<std::mutex> lock(retired_mutex_);
+    retired.swap(retired_);
+    has_retired_.store(false, std::memory_order_relaxed);
+  }
+
+  for (const auto& subscription : retired) {
+    switch (subscription.kind) {
+      case SubscriptionKind::Broadcast:
+        EraseHandler(subscription.event_type, subscription.handler_id);
+        break;
+      case SubscriptionKind::Targeted:
+        EraseTargetedHandler(subscription.event_type, subscription.target.value(), subscription.handler_id);
+        break;
+      case SubscriptionKind::Batch:
+        EraseBatchHandler(subscription.event_type, subscription.handler_id);
+        break;
+      case SubscriptionKind::Topic:
+        EraseTopicHandler(subscription.handler_id);
+        break;
+    }
+  }
+}
+
+EventHandle EventBus::SubscribeTopic(std::string_view pattern, std::function<void(const TopicEvent&)> handler) {
+  uint64_t handler_id;
+  {
+    auto lock = LockHandlers();
+    handler_id = next_handler_id_++;
+    topic_subscriptions_.emplace(handler_id, TopicSubscription{std::string(pattern), std::move(handler)});
+    topic_trie_.Insert(pattern, handler_id);
+    resolved_topics_.clear();
+    broadcast_snapshots_.clear();
+  }
+
+  return EventHandle(weak_from_this(), std::type_index(typeid(TopicEvent)), handler_id, SubscriptionKind::Topic);
+}
+
+void EventBus::FlushBatches() {
+  std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+
+  struct ReadyBatch {
+    std::type_index type_id;
+    BatchSlot* slot;
+  };
+  std::vector<ReadyBatch> ready;
+
+  {
+    std::unique_lock<std::mutex> lock(batch_mutex_);
+    for (auto& [type_id, slot] : pending_batches_) {
+      if (!slot.empty(slot.pending.get())) {
+        std::swap(slot.pending, slot.spare);
+        ready.push_back({type_id, &slot});  // node-based map: slot address is stable, entries are never erased
+      }
+    }
+  }
+
+  for (auto& batch : ready) {
+    std::vector<TypeErasedHandler> handlers_snapshot;
+    {
+      auto lock = LockHandlers();
+      auto event_it = batch_handlers_.find(batch.type_id);
+      if (event_it != batch_handlers_.end()) {
+        handlers_snapshot.reserve(event_it->second.size());
+        for (const auto& [id, handler] : event_it->second) {
+          handlers_snapshot.push_back(handler);
+        }
+      }
+    }
+
+    for (auto& handler : handlers_snapshot) {
+      try {
+        handler(batch.slot->spare.get());
+      } catch (const std::exception&) {
+      }
+    }
+
+    batch.slot->clear(batch.slot->spare.get());
+  }
+}
@@ -7,9 +7,17 @@
  * Key Features:
  * - Compile-time type safety (no std::any, no runtime casting)
  * - Sync/Async emit with optional cancellation
+ * - Fork-join EmitParallel that spreads handlers across the pool with the caller joining in
+ * - EmitTargetedBatch delivering many (event, target) pairs under a single handler-lock acquisition
  * - RAII EventHandle for automatic cleanup
  * - Thread-safe handler storage with unique_lock + snapshot pattern
  * - ID-based subscriptions (unsubscribe is O(1) and doesn't invalidate other handles)
+ * - Opt-in single-flight PublishAsync for events exposing SingleFlightKey()
+ * - Deferred structure-of-arrays batch delivery for events with a BatchLayout (EmitDeferred + FlushBatches)
+ * - Optional EventRecorder capturing every Emit/EmitTargeted for replay
+ * - Wildcard topic subscriptions over EventName ("player.*", "#"), resolved once per event type
+ * - Sticky events: the last value is replayed to late subscribers and readable without a lock via StickySlot
+ * - EventHandle::Retire for deferred bulk removal (EventScope teardown stays off the handler lock)
  *
  * @code{.cpp}
  * struct PlayerDamagedEvent : Event<PlayerDamagedEvent> {
@@ -34,27 +42,61 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <typeindex>
 #include <unordered_map>
 #include <vector>
 
+#include "CacheLine.hpp"
 #include "CancellationToken.hpp"
 #include "Event.hpp"
+#include "EventBatch.hpp"
+#include "EventRecorder.hpp"
+#include "ParallelFor.hpp"
 #include "SubjectID.hpp"
 #include "Task.hpp"
 #include "TaskExtensions.hpp"
 #include "ThreadPool.hpp"
+#include "TopicTrie.hpp"
 
 class EventBus;
 
+enum class SubscriptionKind : uint8_t { Broadcast, Targeted, Batch, Topic };
+
+// What a topic subscriber receives: the concrete event is only reachable through As<E>()
+struct TopicEvent {
+  std::string_view name;
+  const void* payload;
+  std::type_index type;
+
+  template <typename E>
+    requires EventType<E>
+  const E* As() const {
+    return type == std::type_index(typeid(E)) ? static_cast<const E*>(payload) : nullptr;
+  }
+};
+
 class EventHandle {
  public:
   EventHandle(std::weak_ptr<EventBus> bus, std::type_index event_type, uint64_t handler_id, std::optional<SubjectID> target = std::nullopt)
-      : bus_(std::move(bus)), event_type_(event_type), handler_id_(handler_id), target_(target) {
+      : bus_(std::move(bus)),
+        event_type_(event_type),
+        handler_id_(handler_id),
+        target_(target),
+        kind_(target ? SubscriptionKind::Targeted : SubscriptionKind::Broadcast) {
+  }
+
+  EventHandle(std::weak_ptr<EventBus> bus, std::type_index event_type, uint64_t handler_id, SubscriptionKind kind)
+      : bus_(std::move(bus)), event_type_(event_type), handler_id_(handler_id), kind_(kind) {
   }
 
   ~EventHandle() {
@@ -63,6 +105,20 @@ class EventHandle {
 
   void Unsubscribe();
 
+  /**
+   * @brief Detaches the handle like Unsubscribe, but leaves the removal to the bus
+   * @details Queues the subscription on the bus's retired list without taking the handler lock; the entry is
+   *          erased in bulk the next time the bus takes that lock. The handler stays registered until then,
+   *          so callers that must not be invoked again need their own liveness check (EventScope has one).
+   */
+  void Retire();
+
+  /**
+   * @brief Retires a whole batch of handles: one retired-list lock per bus instead of one per handle
+   * @details Handles are grouped by bus and each group is appended with a single EventBus::RetireAll call.
+   */
+  static void RetireAll(std::vector<EventHandle>& handles);
+
   EventHandle(EventHandle&&) = default;
   EventHandle& operator=(EventHandle&&) = default;
 
@@ -74,9 +130,127 @@ class EventHandle {
   std::type_index event_type_;
   uint64_t handler_id_;
   std::optional<SubjectID> target_;
+  SubscriptionKind kind_;
   bool unsubscribed_{false};
 };
 
+/**
+ * @brief Latest value of a sticky event type; hold on to the slot from GetStickySlot to read it without the bus lock
+ * @details The value lives behind a raw pointer guarded by a two-counter epoch scheme. Load registers in the counter
+ *          of the current epoch, copies the shared_ptr and leaves: a fixed number of atomic operations, no lock and
+ *          no retry, so readers are wait-free. Store swaps the pointer, then flips the epoch twice and waits for each
+ *          old counter to drain before deleting the previous holder; the wait only covers readers already inside
+ *          Load. Copies handed out by Load keep their value alive on their own.
+ * @note Store calls are serialized by the bus lock; only Load may run concurrently with anything
+ */
+template <typename E>
+  requires StickyEvent<E>
+class StickySlot {
+  static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<const std::shared_ptr<const E>*>::is_always_lock_free,
+                "StickySlot::Load relies on lock-free counters and pointer loads");
+
+ public:
+  StickySlot() = default;
+
+  ~StickySlot() {
+    delete current_.load(std::memory_order_relaxed);
+  }
+
+  StickySlot(const StickySlot&) = delete;
+  StickySlot& operator=(const StickySlot&) = delete;
+
+  // nullptr until the first emit
+  std::shared_ptr<const E> Load() const {
+    auto& readers = readers_[epoch_.load() & 1];
+    readers.fetch_add(1);
+    const std::shared_ptr<const E>* current = current_.load();
+    std::shared_ptr<const E> value = current ? *current : nullptr;
+    readers.fetch_sub(1, std::memory_order_release);
+    return value;
+  }
+
+ private:
+  friend class EventBus;
+
+  void Store(const E& event) {
+    auto* previous = current_.exchange(new std::shared_ptr<const E>(std::make_shared<const E>(event)));
+    if (previous) {
+      WaitForReaders();
+      delete previous;
+    }
+  }
+
+  // Two flips: a reader that read the epoch before the first flip but registered late is caught by the second
+  void WaitForReaders() {
+    for (int flip = 0; flip < 2; ++flip) {
+      auto& readers = readers_[epoch_.fetch_add(1) & 1];
+      while (readers.load() != 0) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  std::atomic<const std::shared_ptr<const E>*> current_{nullptr};
+  std::atomic<uint64_t> epoch_{0};
+  alignas(kCacheLineSize) mutable std::atomic<uint64_t> readers_[2] = {0, 0};  // written by every Load; off the pointer's line
+};
+
+/**
+ * @brief Orders a sticky subscriber's catch-up value before anything dispatched to it while the catch-up runs
+ * @details The subscription is live in the handler map before the catch-up value is delivered, so a concurrent emit
+ *          can reach the handler first. Until Deliver has passed the catch-up value, such dispatches are queued here
+ *          and delivered afterwards by the subscribing thread, in dispatch order, so the last value the subscriber
+ *          sees is never older than the slot.
+ * @note A dispatch queued this way returns before the subscriber has seen its value
+ */
+template <typename E>
+class StickyCatchUp {
+ public:
+  // True if event was queued behind the catch-up value instead of being handed to the handler now
+  bool DeferIfPending(const E& event) {
+    if (live_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (live_.load(std::memory_order_relaxed)) {
+      return false;
+    }
+    deferred_.push_back(event);
+    return true;
+  }
+
+  // Runs on the subscribing thread: the catch-up value, then whatever dispatch queued meanwhile, then goes live
+  void Deliver(const E& latest, const std::function<void(const E&)>& handler) {
+    Invoke(handler, latest);
+    while (true) {
+      std::vector<E> batch;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (deferred_.empty()) {
+          live_.store(true, std::memory_order_release);
+          return;
+        }
+        batch.swap(deferred_);
+      }
+      for (const E& event : batch) {
+        Invoke(handler, event);
+      }
+    }
+  }
+
+ private:
+  static void Invoke(const std::function<void(const E&)>& handler, const E& event) {
+    try {
+      handler(event);
+    } catch (const std::exception&) {
+    }
+  }
+
+  std::atomic<bool> live_{false};
+  std::mutex mutex_;
+  std::vector<E> deferred_;
+};
+
 class EventBus : public std::enable_shared_from_this<EventBus> {
  public:
   explicit EventBus(ThreadPool& pool) : pool_(pool) {
@@ -86,22 +260,22 @@ class EventBus : public std::enable_shared_from_this<EventBus> {
     requires EventType<E>
   void Emit(const E& event) {
     // Take the registered handler
-    std::type_index type_id(typeid(E));
-    std::vector<TypeErasedHandler> handlers_snapshot;  // prevent long lock holds and potential deadlocks
+    std::shared_ptr<const HandlerSnapshot> handlers_snapshot;  // shared copy-on-write list: no per-emit copy, short lock hold
+    std::shared_ptr<EventRecorder> recorder;
 
     {
-      std::unique_lock<std::mutex> lock(handlers_mutex_);
-      auto event_it = event_handlers_.find(type_id);
-      if (event_it != event_handlers_.end()) {
-        handlers_snapshot.reserve(event_it->second.size());
-        for (const auto& [id, handler] : event_it->second) {
-          handlers_snapshot.push_back(handler);  // copy assignment
-        }
-      }
+      auto lock = LockHandlers();
+      recorder = recorder_;
+      UpdateSticky(event);
+      handlers_snapshot = BroadcastSnapshot<E>();
+    }
+
+    if (recorder) {
+      recorder->Record(event);
     }
 
     // Execute the registered handler
-    for (auto& handler : handlers_snapshot) {
+    for (auto& handler : *handlers_snapshot) {
       try {
         handler(&event);
       } catch (const std::exception&) {
@@ -109,27 +283,53 @@ class EventBus : public std::enable_shared_from_this<EventBus> {
     }
   }
 
+  /**
+   * @brief Emits synchronously, running handlers in parallel on the pool; returns once all have finished
+   * @details The calling thread takes handler invocations alongside the pool helpers (fork-join), so it is safe
+   *          to call from a pool worker. Intended for events with many independent, CPU-heavy handlers;
+   *          handlers must tolerate running concurrently with each other.
+   * @param grain Handlers claimed per step; raise it when individual handlers are cheap
+   */
   template <typename E>
     requires EventType<E>
-  void EmitAsync(const E& event) {
+  void EmitParallel(const E& event, size_t grain = 1) {
     // Take the registered handler
-    std::type_index type_id(typeid(E));
-    std::vector<TypeErasedHandler> handlers_snapshot;  // prevent long lock holds and potential deadlocks
+    std::shared_ptr<const HandlerSnapshot> handlers_snapshot;  // shared copy-on-write list: no per-emit copy, short lock hold
 
     {
-      std::unique_lock<std::mutex> lock(handlers_mutex_);
-      auto event_it = event_handlers_.find(type_id);
-      if (event_it != event_handlers_.end()) {
-        handlers_snapshot.reserve(event_it->second.size());
-        for (const auto& [id, handler] : event_it->second) {
-          handlers_snapshot.push_back(handler);  // copy assignment
+      auto lock = LockHandlers();
+      UpdateSticky(event);
+      handlers_snapshot = BroadcastSnapshot<E>();
+    }
+
+    // Execute the registered handler
+    ParallelFor(
+      pool_,
+      handlers_snapshot->size(),
+      [&handlers_snapshot, &event](size_t index) {
+        try {
+          (*handlers_snapshot)[index](&event);
+        } catch (const std::exception&) {
         }
-      }
+      },
+      grain);
+  }
+
+  template <typename E>
+    requires EventType<E>
+  void EmitAsync(const E& event) {
+    // Take the registered handler
+    std::shared_ptr<const HandlerSnapshot> handlers_snapshot;  // shared copy-on-write list: no per-emit copy, short lock hold
+
+    {
+      auto lock = LockHandlers();
+      UpdateSticky(event);
+      handlers_snapshot = BroadcastSnapshot<E>();
     }
 
     // Execute the registered handler
     auto event_copy = std::make_shared<E>(event);  // prevent access violation when leaving the scope
-    for (auto& handler : handlers_snapshot) {
+    for (auto& handler : *handlers_snapshot) {
       pool_.Enqueue([handler, event_copy]() {
         try {
           handler(event_copy.get());
@@ -147,23 +347,17 @@ class EventBus : public std::enable_shared_from_this<EventBus> {
     }
 
     // Take the registered handler
-    std::type_index type_id(typeid(E));
-    std::vector<TypeErasedHandler> handlers_snapshot;  // prevent long lock holds and potential deadlocks
+    std::shared_ptr<const HandlerSnapshot> handlers_snapshot;  // shared copy-on-write list: no per-emit copy, short lock hold
 
     {
-      std::unique_lock<std::mutex> lock(handlers_mutex_);
-      auto event_it = event_handlers_.find(type_id);
-      if (event_it != event_handlers_.end()) {
-        handlers_snapshot.reserve(event_it->second.size());
-        for (const auto& [id, handler] : event_it->second) {
-          handlers_snapshot.push_back(handler);  // copy assignment
-        }
-      }
+      auto lock = LockHandlers();
+      UpdateSticky(event);
+      handlers_snapshot = BroadcastSnapshot<E>();
     }
 
     // Execute the registered handler
     auto event_copy = std::make_shared<E>(event);  // prevent access violation when leaving the scope
-    for (auto& handler : handlers_snapshot) {
+    for (auto& handler : *handlers_snapshot) {
       if (token && token->IsCancelled()) {
         break;
       }
@@ -184,23 +378,20 @@ class EventBus : public std::enable_shared_from_this<EventBus> {
     requires EventType<E>
   void EmitTargeted(const E& event, SubjectID target) {
     std::type_index type_id(typeid(E));
-    std::vector<TypeErasedHandler> handlers_snapshot;
+    std::shared_ptr<const HandlerSnapshot> handlers_snapshot;
+    std::shared_ptr<EventRecorder> recorder;
 
     {
-      std::unique_lock<std::mutex> lock(handlers_mutex_);
-      auto event_it = targeted_handlers_.find(type_id);
-      if (event_it != targeted_handlers_.end()) {
-        auto target_it = event_it->second.find(target);
-        if (target_it != event_it->second.end()) {
-          handlers_snapshot.reserve(target_it->second.size());
-          for (const auto& [id, handler] : target_it->second) {
-            handlers_snapshot.push_back(handler);
-          }
-        }
-      }
+      auto lock = LockHandlers();
+      recorder = recorder_;
+      handlers_snapshot = TargetedSnapshot(type_id, target);
     }
 
-    for (auto& handler : handlers_snapshot) {
+    if (recorder) {
+      recorder->Record(event, target);
+    }
+
+    for (auto& handler : *handlers_snapshot) {
       try {
         handler(&event);
       } catch (const std::exception&) {
@@ -208,28 +399,56 @@ class EventBus : public std::enable_shared_from_this<EventBus> {
     }
   }
 
+  /**
+   * @brief Emits events[i] to targets[i] for every i, synchronously and in order
+   * @details Handler lists for the whole batch are taken under one lock acquisition instead of one per event, which is
+   *          what a physics step emitting a contact list to both bodies of every contact wants.
+   * @throws std::invalid_argument if the spans differ in size
+   */
   template <typename E>
     requires EventType<E>
-  void EmitTargetedAsync(const E& event, SubjectID target) {
+  void EmitTargetedBatch(std::span<const E> events, std::span<const SubjectID> targets) {
+    if (events.size() != targets.size()) {
+      throw std::invalid_argument("EmitTargetedBatch: events and targets differ in size");
+    }
     std::type_index type_id(typeid(E));
-    std::vector<TypeErasedHandler> handlers_snapshot;
+    std::vector<std::shared_ptr<const HandlerSnapshot>> snapshots(events.size());
+    std::shared_ptr<EventRecorder> recorder;
 
     {
-      std::unique_lock<std::mutex> lock(handlers_mutex_);
-      auto event_it = targeted_handlers_.find(type_id);
-      if (event_it != targeted_handlers_.end()) {
-        auto target_it = event_it->second.find(target);
-        if (target_it != event_it->second.end()) {
-          handlers_snapshot.reserve(target_it->second.size());
-          for (const auto& [id, handler] : target_it->second) {
-            handlers_snapshot.push_back(handler);
-          }
+      auto lock = LockHandlers();
+      recorder = recorder_;
+      for (size_t i = 0; i < targets.size(); ++i) {
+        snapshots[i] = i > 0 && targets[i] == targets[i - 1] ? snapshots[i - 1] : TargetedSnapshot(type_id, targets[i]);
+      }
+    }
+
+    for (size_t i = 0; i < events.size(); ++i) {
+      if (recorder) {
+        recorder->Record(events[i], targets[i]);
+      }
+      for (auto& handler : *snapshots[i]) {
+        try {
+          handler(&events[i]);
+        } catch (const std::exception&) {
         }
       }
     }
+  }
+
+  template <typename E>
+    requires EventType<E>
+  void EmitTargetedAsync(const E& event, SubjectID target) {
+    std::type_index type_id(typeid(E));
+    std::shared_ptr<const HandlerSnapshot> handlers_snapshot;
+
+    {
+      auto lock = LockHandlers();
+      handlers_snapshot = TargetedSnapshot(type_id, target);
+    }
 
     auto event_copy = std::make_shared<E>(event);
-    for (auto& handler : handlers_snapshot) {
+    for (auto& handler : *handlers_snapshot) {
       pool_.Enqueue([handler, event_copy]() {
         try {
           handler(event_copy.get());
@@ -247,24 +466,15 @@ class EventBus : public std::enable_shared_from_this<EventBus> {
     }
 
     std::type_index type_id(typeid(E));
-    std::vector<TypeErasedHandler> handlers_snapshot;
+    std::shared_ptr<const HandlerSnapshot> handlers_snapshot;
 
     {
-      std::unique_lock<std::mutex> lock(handlers_mutex_);
-      auto event_it = targeted_handlers_.find(type_id);
-      if (event_it != targeted_handlers_.end()) {
-        auto target_it = event_it->second.find(target);
-        if (target_it != event_it->second.end()) {
-          handlers_snapshot.reserve(target_it->second.size());
-          for (const auto& [id, handler] : target_it->second) {
-            handlers_snapshot.push_back(handler);
-          }
-        }
-      }
+      auto lock = LockHandlers();
+      handlers_snapshot = TargetedSnapshot(type_id, target);
     }
 
     auto event_copy = std::make_shared<E>(event);
-    for (auto& handler : handlers_snapshot) {
+    for (auto& handler : *handlers_snapshot) {
       if (token && token->IsCancelled()) {
         break;
       }
@@ -299,18 +509,76 @@ class EventBus : public std::enable_shared_from_this<EventBus> {
     return PublishAsyncImpl(event, token);
   }
 
+  /**
+   * @brief Publishes event asynchronously, sharing the in-flight task of an identical publish
+   * @details Publishes whose SingleFlightKey() compares equal while a previous one is still running
+   *          return that task instead of dispatching the handlers again.
+   * @note No cancellation overload: a shared dispatch must not be cancelled by one of its callers
+   */
+  template <typename E>
+    requires SingleFlightEvent<E>
+  std::shared_ptr<Task<void>> PublishAsyncSingleFlight(const E& event) {
+    using Key = std::decay_t<decltype(event.SingleFlightKey())>;
+    using Table = std::unordered_map<Key, std::shared_ptr<Task<void>>>;
+
+    std::type_index type_id(typeid(E));
+    auto key = event.SingleFlightKey();
+
+    // Held across the publish so two identical callers cannot both miss
+    std::unique_lock<std::mutex> lock(single_flight_mutex_);
+    auto& slot = single_flight_[type_id];
+    if (!slot) {
+      slot = std::make_shared<Table>();
+    }
+    auto& table = *static_cast<Table*>(slot.get());
+
+    auto it = table.find(key);
+    if (it != table.end() && !it->second->IsDone()) {
+      return it->second;
+    }
+
+    std::erase_if(table, [](const auto& entry) { return entry.second->IsDone(); });
+
+    auto task = PublishAsyncImpl(event, nullptr);
+    table.insert_or_assign(std::move(key), task);
+    return task;
+  }
+
   template <typename E>
     requires EventType<E>
   EventHandle Subscribe(std::function<void(const E&)> handler) {
     std::type_index type_id(typeid(E));
 
-    auto type_erased_handler = [handler](const void* data) { handler(*static_cast<const E*>(data)); };
+    TypeErasedHandler type_erased_handler = [handler](const void* data) { handler(*static_cast<const E*>(data)); };
 
     uint64_t handler_id;
+    std::shared_ptr<const E> latest;
+    std::shared_ptr<StickyCatchUp<E>> catch_up;
     {
-      std::unique_lock<std::mutex> lock(handlers_mutex_);
+      auto lock = LockHandlers();
       handler_id = next_handler_id_++;
+      if constexpr (StickyEvent<E>) {
+        // Read under the same lock emits store under, so every later value reaches the handler through dispatch;
+        // dispatches that overtake the catch-up are held back by catch_up until it is delivered
+        if (auto slot = FindStickySlot<E>()) {
+          latest = slot->Load();
+        }
+        if (latest) {
+          catch_up = std::make_shared<StickyCatchUp<E>>();
+          type_erased_handler = [handler, catch_up](const void* data) {
+            const E& event = *static_cast<const E*>(data);
+            if (!catch_up->DeferIfPending(event)) {
+              handler(event);
+            }
+          };
+        }
+      }
       event_handlers_[type_id][handler_id] = std::move(type_erased_handler);
+      broadcast_snapshots_.erase(type_id);
+    }
+
+    if (catch_up) {
+      catch_up->Deliver(*latest, handler);
     }
     return EventHandle(weak_from_this(), type_id, handler_id);
   }
@@ -324,14 +592,104 @@ class EventBus : public std::enable_shared_from_this<EventBus> {
 
     uint64_t handler_id;
     {
-      std::unique_lock<std::mutex> lock(handlers_mutex_);
+      auto lock = LockHandlers();
       handler_id = next_handler_id_++;
       targeted_handlers_[type_id][target][handler_id] = std::move(type_erased_handler);
+      InvalidateTargetedSnapshot(type_id, target);
     }
 
     return EventHandle(weak_from_this(), type_id, handler_id, target);
   }
 
+  /**
+   * @brief Slot holding the latest value of sticky event E; created on first use and alive as long as the bus
+   */
+  template <typename E>
+    requires StickyEvent<E>
+  std::shared_ptr<StickySlot<E>> GetStickySlot() {
+    auto lock = LockHandlers();
+    return GetOrCreateStickySlot<E>();
+  }
+
+  /**
+   * @brief Latest emitted value of sticky event E, or nullptr if none has been emitted yet
+   * @note Takes the bus lock for the slot lookup; hot paths should keep the slot from GetStickySlot instead
+   */
+  template <typename E>
+    requires StickyEvent<E>
+  std::shared_ptr<const E> GetLatest() {
+    std::shared_ptr<StickySlot<E>> slot;
+    {
+      auto lock = LockHandlers();
+      slot = FindStickySlot<E>();
+    }
+    return slot ? slot->Load() : nullptr;
+  }
+
+  /**
+   * @brief Subscribes to every event type whose EventName matches pattern
+   * @details Segments are separated by '.'; `*` matches one segment and `#` (or `**`) matches any number of them,
+   *          e.g. "player.*" or "#". Receives broadcast dispatch (Emit, EmitParallel, EmitAsync, PublishAsync),
+   *          not targeted or batched events. Matching runs once per event type after a topic subscription
+   *          changes; emits only read the cached per-type list.
+   */
+  EventHandle SubscribeTopic(std::string_view pattern, std::function<void(const TopicEvent&)> handler);
+
+  /**
+   * @brief Records every subsequent Emit/EmitTargeted into recorder; pass nullptr to stop recording
+   */
+  void SetRecorder(std::shared_ptr<EventRecorder> recorder) {
+    auto lock = LockHandlers();
+    recorder_ = std::move(recorder);
+  }
+
+  /**
+   * @brief Subscribes to structure-of-arrays batches of E, delivered by FlushBatches
+   */
+  template <typename E>
+    requires BatchableEvent<E>
+  EventHandle SubscribeBatch(std::function<void(const EventBatch<E>&)> handler) {
+    std::type_index type_id(typeid(E));
+
+    auto type_erased_handler = [handler](const void* data) { handler(*static_cast<const EventBatch<E>*>(data)); };
+
+    uint64_t handler_id;
+    {
+      auto lock = LockHandlers();
+      handler_id = next_handler_id_++;
+      batch_handlers_[type_id][handler_id] = std::move(type_erased_handler);
+    }
+
+    return EventHandle(weak_from_this(), type_id, handler_id, SubscriptionKind::Batch);
+  }
+
+  /**
+   * @brief Appends event to the pending batch for E; batch subscribers receive it on the next FlushBatches
+   * @note Only batch subscribers see deferred events; regular Subscribe handlers are not invoked
+   */
+  template <typename E>
+    requires BatchableEvent<E>
+  void EmitDeferred(const E& event) {
+    std::type_index type_id(typeid(E));
+
+    std::unique_lock<std::mutex> lock(batch_mutex_);
+    auto& slot = pending_batches_[type_id];
+    if (!slot.pending) {
+      slot.pending = std::make_shared<EventBatch<E>>();
+      slot.spare = std::make_shared<EventBatch<E>>();
+      slot.empty = [](const void* batch) { return static_cast<const EventBatch<E>*>(batch)->Empty(); };
+      slot.clear = [](void* batch) { static_cast<EventBatch<E>*>(batch)->Clear(); };
+    }
+    static_cast<EventBatch<E>*>(slot.pending.get())->Push(event);
+  }
+
+  /**
+   * @brief Delivers every pending batch to its batch subscribers on the calling thread
+   * @details Pending and spare buffers are swapped under the lock, so emitters keep appending while batches
+   *          are dispatched and the buffers are reused without reallocating once warmed up.
+   */
+  void FlushBatches();
+
   EventBus(const EventBus&) = delete;
   EventBus& operator=(const EventBus&) = delete;
 
@@ -339,58 +697,191 @@ class EventBus : public std::enable_shared_from_this<EventBus> {
   friend class EventHandle;
 
   using TypeErasedHandler = std::function<void(const void*)>;
+  using HandlerSnapshot = std::vector<TypeErasedHandler>;
 
   void Unsubscribe(std::type_index event_type, uint64_t handler_id);
   void UnsubscribeTargeted(std::type_index event_type, SubjectID target, uint64_t handler_id);
+  void UnsubscribeBatch(std::type_index event_type, uint64_t handler_id);
+  void UnsubscribeTopic(uint64_t handler_id);
+
+  // Erase* helpers back the Unsubscribe* entry points and the retired-list drain; caller holds handlers_mutex_
+  void EraseHandler(std::type_index event_type, uint64_t handler_id);
+  void EraseTargetedHandler(std::type_index event_type, SubjectID target, uint64_t handler_id);
+  void EraseBatchHandler(std::type_index event_type, uint64_t handler_id);
+  void EraseTopicHandler(uint64_t handler_id);
+
+  struct RetiredSubscription {
+    SubscriptionKind kind;
+    std::type_index event_type;
+    uint64_t handler_id;
+    std::optional<SubjectID> target;
+  };
+
+  void Retire(RetiredSubscription subscription);
+  void RetireAll(std::vector<RetiredSubscription>&& subscriptions);
+
+  // Every handlers_mutex_ acquisition goes through here so retired subscriptions are erased in bulk first
+  std::unique_lock<std::mutex> LockHandlers() {
+    std::unique_lock<std::mutex> lock(handlers_mutex_);
+    if (has_retired_.load(std::memory_order_acquire)) {
+      DrainRetired();
+    }
+    return lock;
+  }
+
+  void DrainRetired();
+
+  void InvalidateTargetedSnapshot(std::type_index event_type, SubjectID target);
+
+  // Double-buffered batch for one event type; `spare` is only touched by FlushBatches under flush_mutex_
+  struct BatchSlot {
+    std::shared_ptr<void> pending;
+    std::shared_ptr<void> spare;
+    bool (*empty)(const void*) = nullptr;
+    void (*clear)(void*) = nullptr;
+  };
+
+  // Sticky slot helpers; caller holds handlers_mutex_
+  template <typename E>
+    requires StickyEvent<E>
+  std::shared_ptr<StickySlot<E>> FindStickySlot() {
+    auto it = sticky_slots_.find(std::type_index(typeid(E)));
+    return it == sticky_slots_.end() ? nullptr : std::static_pointer_cast<StickySlot<E>>(it->second);
+  }
+
+  template <typename E>
+    requires StickyEvent<E>
+  std::shared_ptr<StickySlot<E>> GetOrCreateStickySlot() {
+    auto& slot = sticky_slots_[std::type_index(typeid(E))];
+    if (!slot) {
+      slot = std::make_shared<StickySlot<E>>();
+    }
+    return std::static_pointer_cast<StickySlot<E>>(slot);
+  }
 
   template <typename E>
     requires EventType<E>
-  std::shared_ptr<Task<void>> PublishAsyncImpl(const E& event, CancellationTokenPtr token) {
-    if (token && token->IsCancelled()) {
-      auto cancelled_task = std::make_shared<Task<void>>([]() { throw TaskCancelledException(); });
-      cancelled_task->TrySchedule(pool_);
-      return cancelled_task;
+  void UpdateSticky(const E& event) {
+    if constexpr (StickyEvent<E>) {
+      GetOrCreateStickySlot<E>()->Store(event);
+    }
+  }
+
+  struct TopicSubscription {
+    std::string pattern;
+    std::function<void(const TopicEvent&)> handler;
+  };
+
+  // Appends the topic subscribers matching E::EventName; caller holds handlers_mutex_
+  template <typename E>
+    requires EventType<E>
+  void AppendTopicHandlers(std::vector<TypeErasedHandler>& snapshot) {
+    if (topic_subscriptions_.empty()) {
+      return;
     }
 
     std::type_index type_id(typeid(E));
-    std::vector<TypeErasedHandler> handlers_snapshot;
+    auto cache_it = resolved_topics_.find(type_id);
+    if (cache_it == resolved_topics_.end()) {
+      std::vector<TypeErasedHandler> resolved;
+      for (uint64_t id : topic_trie_.Match(E::EventName)) {
+        resolved.push_back([handler = topic_subscriptions_.at(id).handler, type_id](const void* data) {
+          handler(TopicEvent{E::EventName, data, type_id});
+        });
+      }
+      cache_it = resolved_topics_.emplace(type_id, std::move(resolved)).first;
+    }
 
-    {
-      std::unique_lock<std::mutex> lock(handlers_mutex_);
+    snapshot.insert(snapshot.end(), cache_it->second.begin(), cache_it->second.end());
+  }
+
+  // Broadcast plus matching topic handlers of E, rebuilt only after a subscription change; caller holds handlers_mutex_
+  template <typename E>
+    requires EventType<E>
+  std::shared_ptr<const HandlerSnapshot> BroadcastSnapshot() {
+    std::type_index type_id(typeid(E));
+    auto& cached = broadcast_snapshots_[type_id];
+    if (!cached) {
+      auto snapshot = std::make_shared<HandlerSnapshot>();
       auto event_it = event_handlers_.find(type_id);
       if (event_it != event_handlers_.end()) {
-        handlers_snapshot.reserve(event_it->second.size());
+        snapshot->reserve(event_it->second.size());
         for (const auto& [id, handler] : event_it->second) {
-          handlers_snapshot.push_back(handler);
+          snapshot->push_back(handler);
         }
       }
+      AppendTopicHandlers<E>(*snapshot);
+      cached = std::move(snapshot);
     }
+    return cached;
+  }
 
-    if (handlers_snapshot.empty()) {
+  // Targeted counterpart of BroadcastSnapshot; caller holds handlers_mutex_
+  std::shared_ptr<const HandlerSnapshot> TargetedSnapshot(std::type_index event_type, SubjectID target);
+
+  template <typename E>
+    requires EventType<E>
+  std::shared_ptr<Task<void>> PublishAsyncImpl(const E& event, CancellationTokenPtr token) {
+    if (token && token->IsCancelled()) {
+      auto cancelled_task = std::make_shared<Task<void>>([]() { throw TaskCancelledException(); });
+      cancelled_task->TrySchedule(pool_);
+      return cancelled_task;
+    }
+
+    std::shared_ptr<const HandlerSnapshot> handlers_snapshot;
+
+    {
+      auto lock = LockHandlers();
+      UpdateSticky(event);
+      handlers_snapshot = BroadcastSnapshot<E>();
+    }
+
+    if (handlers_snapshot->empty()) {
       auto empty_task = std::make_shared<Task<void>>([]() {});
       empty_task->TrySchedule(pool_);
       return empty_task;
     }
 
-    auto event_copy = std::make_shared<E>(event);
-    std::vector<std::shared_ptr<Task<void>>> handler_tasks;
-    handler_tasks.reserve(handlers_snapshot.size());
+    // One shared dispatch record and one countdown task instead of a Task per handler plus a WhenAll edge set
+    struct Dispatch {
+      E event;
+      std::shared_ptr<const HandlerSnapshot> handlers;
+      CancellationTokenPtr token;
+      std::shared_ptr<Task<void>> completion;
+
+      // A handler job dropped by a pool shutdown still owes completion its signal; context is the Dispatch, kept
+      // alive by the discarded job until the hook returns
+      static bool Discarded(void* context, ThreadPool& pool) {
+        static_cast<Dispatch*>(context)->completion->OnPredecessorFinished(pool, std::make_exception_ptr(TaskDiscardedException()));
+        return true;
+      }
+    };
 
-    for (auto& handler : handlers_snapshot) {
-      auto task = std::make_shared<Task<void>>([handler, event_copy, token]() {
-        if (token && token->IsCancelled()) {
-          return;
+    auto completion = std::make_shared<Task<void>>([token]() {
+      if (token && token->IsCancelled()) {
+        throw TaskCancelledException();
+      }
+    });
+    completion->AddPendingSignals(static_cast<int>(handlers_snapshot->size()));
+
+    auto dispatch = std::make_shared<Dispatch>(Dispatch{event, std::move(handlers_snapshot), token, completion});
+
+    ThreadPool::DiscardHook on_discard{&Dispatch::Discarded, dispatch.get()};
+    for (size_t index = 0; index < dispatch->handlers->size(); ++index) {
+      pool_.Enqueue([&pool = pool_, dispatch, index]() {
+        std::exception_ptr handler_exception = nullptr;
+        if (!(dispatch->token && dispatch->token->IsCancelled())) {
+          try {
+            (*dispatch->handlers)[index](&dispatch->event);
+          } catch (...) {
+            handler_exception = std::current_exception();
+          }
         }
-        handler(event_copy.get());
-      });
-      handler_tasks.push_back(task);
+        dispatch->completion->OnPredecessorFinished(pool, handler_exception);
+      }, on_discard);
     }
 
-    if (token) {
-      return WhenAllWithCancellation(pool_, handler_tasks, token);
-    } else {
-      return WhenAll(pool_, handler_tasks);
-    }
+    return completion;
   }
 
   ThreadPool& pool_;
@@ -398,4 +889,29 @@ class EventBus : public std::enable_shared_from_this<EventBus> {
   std::mutex handlers_mutex_;
   std::unordered_map<std::type_index, std::unordered_map<uint64_t, TypeErasedHandler>> event_handlers_;
   std::unordered_map<std::type_index, std::unordered_map<SubjectID, std::unordered_map<uint64_t, TypeErasedHandler>>> targeted_handlers_;
+
+  std::unordered_map<std::type_index, std::unordered_map<uint64_t, TypeErasedHandler>> batch_handlers_;
+  std::shared_ptr<EventRecorder> recorder_;  // guarded by handlers_mutex_
+
+  // Topic subscriptions, guarded by handlers_mutex_; resolved_topics_ is cleared whenever the trie changes
+  std::unordered_map<uint64_t, TopicSubscription> topic_subscriptions_;
+  TopicTrie topic_trie_;
+  std::unordered_map<std::type_index, std::vector<TypeErasedHandler>> resolved_topics_;
+
+  // Copy-on-write dispatch lists shared by in-flight emits; entries are dropped whenever their source changes
+  std::unordered_map<std::type_index, std::shared_ptr<const HandlerSnapshot>> broadcast_snapshots_;
+  std::unordered_map<std::type_index, std::unordered_map<SubjectID, std::shared_ptr<const HandlerSnapshot>>> targeted_snapshots_;
+
+  std::unordered_map<std::type_index, std::shared_ptr<void>> sticky_slots_;  // type -> StickySlot<E>, guarded by handlers_mutex_
+
+  std::mutex retired_mutex_;  // taken after handlers_mutex_ when both are held
+  std::vector<RetiredSubscription> retired_;
+  std::atomic<bool> has_retired_{false};
+
+  std::mutex flush_mutex_;  // serializes FlushBatches; taken before batch_mutex_
+  std::mutex batch_mutex_;
+  std::unordered_map<std::type_index, BatchSlot> pending_batches_;
+
+  std::mutex single_flight_mutex_;
+  std::unordered_map<std::type_index, std::shared_ptr<void>> single_flight_;  // type -> unordered_map<Key, in-flight task>
 };
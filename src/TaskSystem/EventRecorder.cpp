@@ -0,0 +1,94 @@
+/**
+ * @file EventRecorder.cpp
+ * @brief Implementation of EventRecorder.
+ */
+
+#include "EventRecorder.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+std::atomic<uint64_t> g_next_recorder_id{1};
+
+constexpr size_t kInitialLogCapacity = 1 << 20;  // the log doubles from here as it fills
+
+}  // namespace
+
+EventRecorder::EventRecorder(const std::string& path, size_t flush_threshold_bytes)
+    : id_(g_next_recorder_id.fetch_add(1, std::memory_order_relaxed)),
+      flush_threshold_bytes_(flush_threshold_bytes),
+      start_(std::chrono::steady_clock::now()),
+      file_(MappedFile::Create(path, std::max(kInitialLogCapacity, 4 * flush_threshold_bytes))) {
+  EventLogFileHeader header{};
+  std::memcpy(header.magic, kEventLogMagic, sizeof(header.magic));
+  header.version = kEventLogVersion;
+  if (!file_.Append(&header, sizeof(header))) {
+    throw std::runtime_error("EventRecorder: cannot write the header of " + path);
+  }
+}
+
+EventRecorder::~EventRecorder() {
+  Flush();
+}
+
+EventRecorder::ThreadBuffer& EventRecorder::LocalBuffer() {
+  struct Cache {
+    uint64_t recorder_id = 0;
+    ThreadBuffer* buffer = nullptr;
+  };
+  thread_local Cache cache;
+
+  if (cache.recorder_id == id_) {
+    return *cache.buffer;
+  }
+
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  auto this_thread = std::this_thread::get_id();
+  ThreadBuffer* found = nullptr;
+  for (auto& buffer : buffers_) {
+    if (buffer->owner == this_thread) {
+      found = buffer.get();
+      break;
+    }
+  }
+  if (!found) {
+    buffers_.push_back(std::make_unique<ThreadBuffer>());
+    found = buffers_.back().get();
+    found->owner = this_thread;
+    found->bytes.reserve(flush_threshold_bytes_);
+  }
+
+  cache = Cache{id_, found};
+  return *found;
+}
+
+void EventRecorder::WriteChunk(ThreadBuffer& buffer) {
+  bool written;
+  {
+    std::lock_guard<std::mutex> lock(file_mutex_);
+    written = file_.Append(buffer.bytes.data(), buffer.bytes.size());
+  }
+  if (!written) {
+    dropped_count_.fetch_add(buffer.records, std::memory_order_relaxed);
+  }
+  buffer.bytes.clear();
+  buffer.records = 0;
+}
+
+bool EventRecorder::Flush() {
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  for (auto& buffer : buffers_) {
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+    if (!buffer->bytes.empty()) {
+      WriteChunk(*buffer);
+    }
+  }
+
+  // Publish how far the log is complete; the mapping makes it visible to readers without a write call
+  std::lock_guard<std::mutex> file_lock(file_mutex_);
+  uint64_t records_size = file_.Size() - sizeof(EventLogFileHeader);
+  std::memcpy(file_.Data() + offsetof(EventLogFileHeader, records_size), &records_size, sizeof(records_size));
+  return dropped_count_.load(std::memory_order_relaxed) == 0;
+}
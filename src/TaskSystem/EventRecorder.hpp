@@ -0,0 +1,142 @@
+/**
+ * @file EventRecorder.hpp
+ * @brief Append-only binary log of emitted events for desync reproduction and offline dispatch benchmarks.
+ * @details Attach with EventBus::SetRecorder. Every Emit/EmitTargeted of a recordable event appends
+ *          (event id, SubjectID, timestamp, payload) to a buffer owned by the emitting thread; buffers are
+ *          copied into the memory-mapped log (MappedFile) in whole-record chunks once they pass the flush
+ *          threshold, so emitters never contend on a shared buffer. Replay with EventReplayer.
+ * @note The header's records_size is updated on every Flush; a reader of a log whose session died stops there
+ *       rather than at the end of the file, which is grown ahead of the records and only trimmed on close.
+ * @note When the log cannot grow (disk full), the chunk's records are dropped and counted by GetDroppedCount
+ * @note Payloads use EventSerialization: trivially copyable events as raw bytes, others through EventSchema<E>.
+ *       Events that are neither are counted as skipped
+ *
+ * Log layout (native endianness):
+ *   EventLogFileHeader, then records_size bytes of records: EventLogRecordHeader followed by payload_size bytes
+ *
+ * @code{.cpp}
+ * auto recorder = std::make_shared<EventRecorder>("session.evlog");
+ * bus->SetRecorder(recorder);
+ * bus->Emit(PlayerDamagedEvent{.player_id = 1, .damage = 25.0f});
+ * recorder->Flush();
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Event.hpp"
+#include "EventSerialization.hpp"
+#include "SharedMemory.hpp"
+#include "SubjectID.hpp"
+
+struct EventLogFileHeader {
+  char magic[4];
+  uint32_t version;
+  uint64_t records_size;  // bytes of records that follow, as of the last Flush
+};
+
+struct EventLogRecordHeader {
+  uint64_t event_id;      // Event<E>::GetEventId()
+  int64_t timestamp_ns;   // since the recorder was created
+  uint64_t target;        // SubjectID value when has_target is set
+  uint32_t payload_size;
+  uint8_t has_target;
+  uint8_t reserved[3];
+};
+
+inline constexpr char kEventLogMagic[4] = {'E', 'V', 'L', 'G'};
+inline constexpr uint32_t kEventLogVersion = 2;
+
+class EventRecorder {
+ public:
+  explicit EventRecorder(const std::string& path, size_t flush_threshold_bytes = 64 * 1024);
+  ~EventRecorder();
+
+  template <typename E>
+    requires EventType<E>
+  void Record(const E& event, std::optional<SubjectID> target = std::nullopt) {
+    if constexpr (SerializableEvent<E>) {
+      EventLogRecordHeader header{};
+      header.event_id = E::GetEventId();
+      header.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count();
+      header.target = target ? target->value : 0;
+      header.has_target = target ? 1 : 0;
+
+      ThreadBuffer& buffer = LocalBuffer();
+      std::lock_guard<std::mutex> lock(buffer.mutex);
+
+      // Reserve the header slot, serialize the payload behind it, then patch in the payload size
+      size_t offset = buffer.bytes.size();
+      buffer.bytes.resize(offset + sizeof(header));
+      SerializeEvent(event, buffer.bytes);
+      header.payload_size = static_cast<uint32_t>(buffer.bytes.size() - offset - sizeof(header));
+      std::memcpy(buffer.bytes.data() + offset, &header, sizeof(header));
+      buffer.records++;
+      recorded_count_.fetch_add(1, std::memory_order_relaxed);
+
+      if (buffer.bytes.size() >= flush_threshold_bytes_) {
+        WriteChunk(buffer);
+      }
+    } else {
+      skipped_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  // Writes every thread's pending records to the log; false if any record so far failed to reach it
+  bool Flush();
+
+  uint64_t GetRecordedCount() const {
+    return recorded_count_.load(std::memory_order_relaxed);
+  }
+
+  uint64_t GetSkippedCount() const {
+    return skipped_count_.load(std::memory_order_relaxed);
+  }
+
+  // Records lost because the log could not grow
+  uint64_t GetDroppedCount() const {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
+  EventRecorder(const EventRecorder&) = delete;
+  EventRecorder& operator=(const EventRecorder&) = delete;
+  EventRecorder(EventRecorder&&) = delete;
+  EventRecorder& operator=(EventRecorder&&) = delete;
+
+ private:
+  struct ThreadBuffer {
+    std::thread::id owner;
+    std::mutex mutex;  // only contended by Flush
+    std::vector<std::byte> bytes;
+    uint64_t records = 0;  // whole records currently held in bytes
+  };
+
+  ThreadBuffer& LocalBuffer();
+  void WriteChunk(ThreadBuffer& buffer);
+
+  const uint64_t id_;  // distinguishes recorders in the per-thread buffer cache
+  const size_t flush_threshold_bytes_;
+  const std::chrono::steady_clock::time_point start_;
+
+  std::mutex buffers_mutex_;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+
+  std::mutex file_mutex_;
+  MappedFile file_;
+
+  std::atomic<uint64_t> recorded_count_{0};
+  std::atomic<uint64_t> skipped_count_{0};
+  std::atomic<uint64_t> dropped_count_{0};
+};
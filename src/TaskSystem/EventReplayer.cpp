@@ -0,0 +1,76 @@
+/**
+ * @file EventReplayer.cpp
+ * @brief Implementation of EventReplayer.
+ */
+
+#include "EventReplayer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+EventReplayer::EventReplayer(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("EventReplayer: cannot open " + path);
+  }
+
+  file.seekg(0, std::ios::end);
+  auto size = static_cast<size_t>(file.tellg());
+  file.seekg(0, std::ios::beg);
+  bytes_.resize(size);
+  file.read(reinterpret_cast<char*>(bytes_.data()), static_cast<std::streamsize>(size));
+
+  EventLogFileHeader file_header{};
+  if (size < sizeof(file_header)) {
+    throw std::runtime_error("EventReplayer: truncated log " + path);
+  }
+  std::memcpy(&file_header, bytes_.data(), sizeof(file_header));
+  if (std::memcmp(file_header.magic, kEventLogMagic, sizeof(file_header.magic)) != 0 || file_header.version != kEventLogVersion) {
+    throw std::runtime_error("EventReplayer: not an event log " + path);
+  }
+
+  // Past records_size is either slack the recorder had not trimmed yet or records written after its last Flush
+  size = std::min(size, sizeof(file_header) + static_cast<size_t>(file_header.records_size));
+  size_t offset = sizeof(file_header);
+  while (offset + sizeof(EventLogRecordHeader) <= size) {
+    EventLogRecordHeader header;
+    std::memcpy(&header, bytes_.data() + offset, sizeof(header));
+    if (offset + sizeof(header) + header.payload_size > size) {
+      break;  // torn tail from an interrupted session
+    }
+    records_.push_back(RecordRef{header.timestamp_ns, offset});
+    offset += sizeof(header) + header.payload_size;
+  }
+
+  std::stable_sort(
+    records_.begin(), records_.end(), [](const RecordRef& a, const RecordRef& b) { return a.timestamp_ns < b.timestamp_ns; });
+}
+
+EventReplayer::ReplayStats EventReplayer::Replay(EventBus& bus) const {
+  ReplayStats stats;
+  auto start = std::chrono::steady_clock::now();
+
+  for (const auto& record : records_) {
+    EventLogRecordHeader header;
+    std::memcpy(&header, bytes_.data() + record.offset, sizeof(header));
+
+    auto decoder_it = decoders_.find(header.event_id);
+    std::optional<SubjectID> target;
+    if (header.has_target) {
+      target = SubjectID(header.target);
+    }
+
+    if (decoder_it != decoders_.end() &&
+        decoder_it->second(bus, bytes_.data() + record.offset + sizeof(header), header.payload_size, target)) {
+      stats.replayed++;
+    } else {
+      stats.skipped++;
+    }
+  }
+
+  stats.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  return stats;
+}
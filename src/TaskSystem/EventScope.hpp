@@ -7,6 +7,10 @@
  * @note The only things that EventScope do is prevent memory issue.
  * Not purposing to interrupt already-executing handlers, use token inside handler for that
  *
+ * @note Teardown hands each bus its share of the handles in one RetireAll call (one retired-list lock per bus)
+ * and never takes the bus handler lock; the bus erases the entries in bulk on its next lock. Until then the
+ * wrappers see the scope as dead and return.
+ *
  * @warning
  * DO NOT capture [this] in SubscribeAsync handlers. Use shared_from_this() instead
  * @code{.cpp}
@@ -21,6 +25,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -32,14 +37,16 @@
 
 class EventScope {
  public:
-  EventScope() : token_(MakeCancellationToken()) {
+  EventScope() : token_(MakeCancellationToken()), alive_(std::make_shared<std::atomic<bool>>(true)) {
   }
 
   ~EventScope() {
+    alive_->store(false, std::memory_order_release);  // sync wrappers stop before their handles are retired
     if (token_) {  // Cancel token before unsubscribing to prevent async UAF
       token_->Cancel();
     }
     std::lock_guard<std::mutex> lock(handles_mutex_);
+    EventHandle::RetireAll(handles_);
     handles_.clear();
   }
 
@@ -47,7 +54,7 @@ class EventScope {
   template <typename E>
     requires EventType<E>
   void Subscribe(EventBus& bus, std::function<void(const E&)> handler) {
-    auto handle = bus.Subscribe<E>(std::move(handler));
+    auto handle = bus.Subscribe<E>(GuardAlive(std::move(handler)));
     {
       std::lock_guard<std::mutex> lock(handles_mutex_);
       handles_.push_back(std::move(handle));
@@ -58,7 +65,7 @@ class EventScope {
   template <typename E>
     requires EventType<E>
   void Subscribe(EventBus& bus, SubjectID target, std::function<void(const E&)> handler) {
-    auto handle = bus.SubscribeTargeted<E>(target, std::move(handler));
+    auto handle = bus.SubscribeTargeted<E>(target, GuardAlive(std::move(handler)));
     {
       std::lock_guard<std::mutex> lock(handles_mutex_);
       handles_.push_back(std::move(handle));
@@ -132,7 +139,19 @@ class EventScope {
   EventScope& operator=(EventScope&&) = delete;
 
  private:
+  // Retired handles stay registered until the bus drains them, so sync handlers check the scope is still alive
+  template <typename E>
+  std::function<void(const E&)> GuardAlive(std::function<void(const E&)> handler) {
+    return [alive = alive_, handler = std::move(handler)](const E& event) {
+      if (!alive->load(std::memory_order_acquire)) {
+        return;
+      }
+      handler(event);
+    };
+  }
+
   CancellationTokenPtr token_;
+  std::shared_ptr<std::atomic<bool>> alive_;
   std::mutex handles_mutex_;
   std::vector<EventHandle> handles_;
 };
@@ -0,0 +1,135 @@
+/**
+ * @file EventSerialization.hpp
+ * @brief Reflection-free, opt-in binary serialization of Event<Derived> payloads.
+ * @details Trivially copyable events serialize as their raw bytes. Other events opt in by specializing
+ *          EventSchema<E> with Write/Read functions that describe their fields. The wire identity of a type is
+ *          Event<E>::GetEventId() (a hash of EventName), so both ends only have to agree on EventName and layout.
+ * @note Raw-byte payloads assume both ends share the struct layout and endianness (same build, same machine)
+ *
+ * @code{.cpp}
+ * template <>
+ * struct EventSchema<SceneLoadedEvent> {
+ *   static void Write(ByteWriter& writer, const SceneLoadedEvent& event) {
+ *     writer.WriteString(event.scene_name);
+ *     writer.WritePod(event.load_time_ms);
+ *   }
+ *   static bool Read(ByteReader& reader, SceneLoadedEvent& event) {
+ *     return reader.ReadString(event.scene_name) && reader.ReadPod(event.load_time_ms);
+ *   }
+ * };
+ * @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "Event.hpp"
+
+// Appends to a caller-owned buffer so serialization can write straight into record or frame storage
+class ByteWriter {
+ public:
+  explicit ByteWriter(std::vector<std::byte>& out) : out_(out) {
+  }
+
+  void Write(const void* data, size_t size) {
+    size_t offset = out_.size();
+    out_.resize(offset + size);
+    std::memcpy(out_.data() + offset, data, size);
+  }
+
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  void WritePod(const T& value) {
+    Write(&value, sizeof(T));
+  }
+
+  void WriteString(std::string_view value) {
+    WritePod(static_cast<uint32_t>(value.size()));
+    Write(value.data(), value.size());
+  }
+
+ private:
+  std::vector<std::byte>& out_;
+};
+
+class ByteReader {
+ public:
+  explicit ByteReader(std::span<const std::byte> data) : data_(data) {
+  }
+
+  bool Read(void* out, size_t size) {
+    if (offset_ + size > data_.size()) {
+      return false;
+    }
+    std::memcpy(out, data_.data() + offset_, size);
+    offset_ += size;
+    return true;
+  }
+
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  bool ReadPod(T& value) {
+    return Read(&value, sizeof(T));
+  }
+
+  bool ReadString(std::string& value) {
+    uint32_t size = 0;
+    if (!ReadPod(size) || offset_ + size > data_.size()) {
+      return false;
+    }
+    value.assign(reinterpret_cast<const char*>(data_.data() + offset_), size);
+    offset_ += size;
+    return true;
+  }
+
+  bool AtEnd() const {
+    return offset_ == data_.size();
+  }
+
+ private:
+  std::span<const std::byte> data_;
+  size_t offset_ = 0;
+};
+
+// Specialize with static Write(ByteWriter&, const E&) and bool Read(ByteReader&, E&) for non-trivially-copyable events
+template <typename E>
+struct EventSchema;
+
+template <typename E>
+concept SchemaDescribedEvent = EventType<E> && requires(ByteWriter& writer, ByteReader& reader, const E& in, E& out) {
+  EventSchema<E>::Write(writer, in);
+  { EventSchema<E>::Read(reader, out) } -> std::convertible_to<bool>;
+};
+
+template <typename E>
+concept SerializableEvent = EventType<E> && (SchemaDescribedEvent<E> || std::is_trivially_copyable_v<E>);
+
+template <typename E>
+  requires SerializableEvent<E>
+void SerializeEvent(const E& event, std::vector<std::byte>& out) {
+  ByteWriter writer(out);
+  if constexpr (SchemaDescribedEvent<E>) {
+    EventSchema<E>::Write(writer, event);
+  } else {
+    writer.Write(&event, sizeof(E));
+  }
+}
+
+template <typename E>
+  requires SerializableEvent<E>
+bool DeserializeEvent(std::span<const std::byte> payload, E& event) {
+  ByteReader reader(payload);
+  if constexpr (SchemaDescribedEvent<E>) {
+    return EventSchema<E>::Read(reader, event) && reader.AtEnd();
+  } else {
+    return payload.size() == sizeof(E) && reader.Read(&event, sizeof(E));
+  }
+}
@@ -0,0 +1,180 @@
+/**
+ * @file Fiber.cpp
+ * @brief Implementation of Fiber over ucontext (POSIX) and Win32 fibers.
+ */
+
+#include "Fiber.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <ucontext.h>
+#endif
+
+namespace {
+
+thread_local Fiber* t_current_fiber = nullptr;
+
+}  // namespace
+
+#ifdef _WIN32
+
+struct Fiber::Context {
+  void* fiber = nullptr;
+  void* worker = nullptr;
+};
+
+struct FiberEntry {
+  static void CALLBACK Start(void* parameter) {
+    static_cast<Fiber*>(parameter)->Run();
+  }
+};
+
+#else
+
+struct Fiber::Context {
+  ucontext_t fiber{};
+  ucontext_t worker{};
+  std::unique_ptr<std::byte[]> stack;
+};
+
+struct FiberEntry {
+  // makecontext passes int arguments only, so the pointer travels as two halves
+  static void Start(unsigned int high, unsigned int low) {
+    auto address = (static_cast<uintptr_t>(high) << 32) | static_cast<uintptr_t>(low);
+    reinterpret_cast<Fiber*>(address)->Run();
+  }
+};
+
+#endif
+
+Fiber::Fiber(ThreadPool& pool, std::function<void()> fn, size_t stack_size)
+    : pool_(pool), fn_(std::move(fn)), context_(std::make_unique<Context>()), error_(std::make_shared<std::exception_ptr>()) {
+#ifdef _WIN32
+  context_->fiber = CreateFiber(stack_size, &FiberEntry::Start, this);
+  if (!context_->fiber) {
+    throw std::runtime_error("Fiber: CreateFiber failed");
+  }
+#else
+  context_->stack = std::make_unique_for_overwrite<std::byte[]>(stack_size);  // pages are committed as the fiber touches them
+  if (getcontext(&context_->fiber) != 0) {
+    throw std::runtime_error("Fiber: getcontext failed");
+  }
+  context_->fiber.uc_stack.ss_sp = context_->stack.get();
+  context_->fiber.uc_stack.ss_size = stack_size;
+  context_->fiber.uc_link = nullptr;  // Run never returns; it switches back to the worker for good
+
+  auto address = reinterpret_cast<uintptr_t>(this);
+  makecontext(&context_->fiber, reinterpret_cast<void (*)()>(&FiberEntry::Start), 2, static_cast<unsigned int>(address >> 32),
+              static_cast<unsigned int>(address & 0xFFFFFFFFu));
+#endif
+}
+
+Fiber::~Fiber() {
+#ifdef _WIN32
+  if (context_->fiber) {
+    DeleteFiber(context_->fiber);
+  }
+#endif
+}
+
+std::shared_ptr<Task<void>> Fiber::Spawn(ThreadPool& pool, std::function<void()> fn, size_t stack_size) {
+  std::shared_ptr<Fiber> fiber(new Fiber(pool, std::move(fn), stack_size));
+
+  fiber->completion_ = std::make_shared<Task<void>>([error = fiber->error_]() {
+    if (*error) {
+      std::rethrow_exception(*error);
+    }
+  });
+  fiber->completion_->AddPendingSignals(1);  // released by Resume once fn has returned
+
+  auto completion = fiber->completion_;
+  ThreadPool::DiscardHook on_discard{&Fiber::DiscardStart, fiber.get()};
+  pool.Enqueue([fiber = std::move(fiber)]() { fiber->Resume(); }, on_discard);
+  return completion;
+}
+
+bool Fiber::DiscardStart(void* context, ThreadPool& pool) {
+  auto* fiber = static_cast<Fiber*>(context);
+  fiber->completion_->OnPredecessorFinished(pool, std::make_exception_ptr(TaskDiscardedException()));
+  return true;
+}
+
+Fiber* Fiber::Current() {
+  return t_current_fiber;
+}
+
+void Fiber::Resume() {
+  auto keep_alive = shared_from_this();
+  Fiber* previous_fiber = std::exchange(t_current_fiber, this);
+  auto previous_hook = std::exchange(t_fiber_wait_hook, &Fiber::Park);
+
+#ifdef _WIN32
+  bool converted = !IsThreadAFiber();
+  context_->worker = converted ? ConvertThreadToFiber(nullptr) : GetCurrentFiber();
+  SwitchToFiber(context_->fiber);
+  if (converted) {
+    ConvertFiberToThread();
+  }
+#else
+  swapcontext(&context_->worker, &context_->fiber);
+#endif
+
+  t_current_fiber = previous_fiber;
+  t_fiber_wait_hook = previous_hook;
+
+  if (finished_) {
+    fn_ = nullptr;
+    auto completion = std::move(completion_);
+    completion->OnPredecessorFinished(pool_);
+    return;
+  }
+
+  // Parked: the completion signal moves to the resumption's Then edge, so a resumption discarded by a pool shutdown
+  // fails the fiber's task instead of leaving it pending. The resumption takes the signal back before resuming.
+  TaskBase* task = std::exchange(parked_on_, nullptr);
+  auto resumption = std::make_shared<Task<void>>([self = std::move(keep_alive)]() {
+    self->completion_->AddPendingSignals(1);
+    self->Resume();
+  });
+  resumption->Then(completion_);
+  completion_->OnPredecessorFinished(pool_);
+
+  // The fiber's registers are saved, so it is safe for the continuation to resume it on another worker from the
+  // moment it is attached, even before this call returns
+  task->AddSuccessor(task->successors_unconditional_, resumption, false);
+}
+
+void Fiber::SwitchToWorker() {
+#ifdef _WIN32
+  SwitchToFiber(context_->worker);
+#else
+  swapcontext(&context_->fiber, &context_->worker);
+#endif
+}
+
+void Fiber::Run() {
+  try {
+    fn_();
+  } catch (...) {
+    *error_ = std::current_exception();
+  }
+  finished_ = true;
+  SwitchToWorker();
+}
+
+void Fiber::Park(TaskBase& task) {
+  Fiber* self = t_current_fiber;
+  self->parked_on_ = &task;
+  self->SwitchToWorker();
+}
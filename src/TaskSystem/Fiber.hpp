@@ -0,0 +1,79 @@
+/**
+ * @file Fiber.hpp
+ * @brief Stackful fibers multiplexed onto ThreadPool workers, for blocking-style code.
+ * @details A fiber runs its function on its own stack, on whichever pool worker resumes it. When the function calls
+ *          Wait on an unfinished Task, the fiber is parked: it switches back to the worker, attaches a resumption
+ *          continuation to the awaited task and frees the worker. The continuation puts the fiber back on the pool
+ *          once the task is done, possibly on another worker. Thousands of waiting fibers thus cost stacks, not threads.
+ *          Contexts are switched with ucontext on POSIX and Win32 fibers on Windows.
+ * @note Only Task::Wait parks; mutexes, condition variables and sleep_for still block the worker
+ * @note A fiber may resume on a different thread after Wait, so do not hold thread_local references across it
+ * @note Each fiber allocates its stack up front; deep recursion needs a larger stack_size
+ * @note If a pool shutdown discards a fiber before it starts or while it is parked, its task completes with
+ *       TaskDiscardedException; a parked fiber's stack is freed without unwinding
+ *
+ * @code{.cpp}
+ * auto done = Fiber::Spawn(pool, [&]() {
+ *   auto load = LoadAsync("level.bin");
+ *   load->Wait();  // parks this fiber, the worker picks up other work
+ *   Spawn(load->GetResult());
+ * });
+ * done->Wait();
+ * @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+
+#include "Task.hpp"
+#include "ThreadPool.hpp"
+
+class Fiber : public std::enable_shared_from_this<Fiber> {
+ public:
+  static constexpr size_t kDefaultStackSize = 64 * 1024;
+
+  // Runs fn as a fiber on pool; the returned task completes when fn returns and rethrows what fn threw
+  static std::shared_ptr<Task<void>> Spawn(ThreadPool& pool, std::function<void()> fn, size_t stack_size = kDefaultStackSize);
+
+  // The fiber running on the calling thread, or nullptr outside fibers
+  static Fiber* Current();
+
+  ~Fiber();
+
+  Fiber(const Fiber&) = delete;
+  Fiber& operator=(const Fiber&) = delete;
+
+ private:
+  struct Context;
+
+  Fiber(ThreadPool& pool, std::function<void()> fn, size_t stack_size);
+
+  // Worker side: runs the fiber until it finishes or parks, then completes or re-arms it
+  void Resume();
+
+  // Fiber side: returns control to the worker that resumed this fiber
+  void SwitchToWorker();
+
+  // Fiber entry point; runs fn_ and switches back for good
+  void Run();
+
+  // Installed as t_fiber_wait_hook while a fiber runs
+  static void Park(TaskBase& task);
+
+  // Discard hook of the first Resume job; completes the fiber's task as discarded
+  static bool DiscardStart(void* context, ThreadPool& pool);
+
+  friend struct FiberEntry;
+
+  ThreadPool& pool_;
+  std::function<void()> fn_;
+  std::unique_ptr<Context> context_;
+  std::shared_ptr<std::exception_ptr> error_;  // shared with the completion task's callback
+  std::shared_ptr<Task<void>> completion_;
+  TaskBase* parked_on_ = nullptr;  // set by Park right before switching out, consumed by Resume
+  bool finished_ = false;
+};
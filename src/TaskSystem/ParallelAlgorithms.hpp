@@ -0,0 +1,195 @@
+/**
+ * @file ParallelAlgorithms.hpp
+ * @brief ParallelTransform, ParallelInclusiveScan and ParallelSort over random-access ranges, built on ParallelFor.
+ * @details Ranges are over-decomposed into several pieces per thread, which the caller and the pool's helpers claim
+ *          from ParallelFor's shared cursor, so a worker that falls behind simply takes fewer pieces.
+ *          - Transform: each piece is an independent std::transform.
+ *          - Inclusive scan: pieces are scanned independently, the piece totals are scanned on the caller, then every
+ *            piece but the first folds its carry in. op must be associative; it need not be commutative.
+ *          - Sort: pieces are sorted with std::sort, then merged pairwise in log2(pieces) rounds that ping-pong with a
+ *            buffer. Each merge is cut along its merge path into pieces of equal output size, so the last rounds stay
+ *            parallel too.
+ *          Ranges no longer than cutoff elements, and pools too small to split them, run the sequential algorithm.
+ * @note The callables are shared by all pieces and must be safe to call concurrently
+ * @note ParallelSort is not stable and needs a default-constructible, move-assignable value type for its buffer
+ * @note Like ParallelFor, safe to call from a pool worker; the first exception is rethrown once all pieces finished
+ *
+ * @code{.cpp}
+ * ParallelSort(pool, draws.begin(), draws.end(), [](const Draw& a, const Draw& b) { return a.key < b.key; });
+ * ParallelInclusiveScan(pool, visible.begin(), visible.end(), offsets.begin());
+ * ParallelTransform(pool, positions.begin(), positions.end(), positions.begin(), [&](Vec3 p) { return p + v * dt; });
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "ParallelFor.hpp"
+#include "ThreadPool.hpp"
+
+// Below this many elements per piece, splitting costs more than it saves
+inline constexpr size_t kParallelAlgorithmCutoff = 1 << 14;
+
+namespace detail {
+
+inline constexpr size_t kPiecesPerThread = 4;
+
+// How many pieces to cut count elements into: at least cutoff elements each, a few per thread (caller included)
+inline size_t PieceCount(ThreadPool& pool, size_t count, size_t cutoff) {
+  size_t by_size = count / std::max<size_t>(cutoff, 1);
+  size_t by_threads = (pool.GetThreadCount() + 1) * kPiecesPerThread;
+  return std::max<size_t>(1, std::min(by_size, by_threads));
+}
+
+// Start of piece index when count elements are cut into pieces near-equal parts (index == pieces gives count)
+inline size_t PieceBegin(size_t count, size_t pieces, size_t index) {
+  return count / pieces * index + count % pieces * index / pieces;
+}
+
+// How many elements of a come first among the first diagonal outputs of std::merge(a, b), which takes ties from a
+template <typename It, typename Compare>
+size_t MergePathSplit(It a, size_t a_size, It b, size_t b_size, size_t diagonal, Compare& comp) {
+  size_t low = diagonal > b_size ? diagonal - b_size : 0;
+  size_t high = std::min(diagonal, a_size);
+  while (low < high) {
+    size_t from_a = low + (high - low) / 2;
+    if (!comp(b[diagonal - from_a - 1], a[from_a])) {
+      low = from_a + 1;  // a[from_a] is not after b's last candidate, so it is among the first diagonal outputs
+    } else {
+      high = from_a;
+    }
+  }
+  return low;
+}
+
+// One round of ParallelSort: merges runs [2k*width, (2k+1)*width) and [(2k+1)*width, (2k+2)*width) of src into dst
+template <typename Src, typename Dst, typename Compare>
+void MergeRound(ThreadPool& pool, Src src, Dst dst, size_t count, size_t runs, size_t width, Compare& comp) {
+  size_t merges = runs / (2 * width);
+  size_t splits = std::max<size_t>(1, (pool.GetThreadCount() + 1) * kPiecesPerThread / merges);
+
+  // Cuts are found before any piece moves elements out of src, which the searches of other pieces still read
+  std::vector<size_t> cuts(merges * (splits + 1));
+  for (size_t merge = 0; merge < merges; ++merge) {
+    size_t begin = PieceBegin(count, runs, 2 * width * merge);
+    size_t middle = PieceBegin(count, runs, 2 * width * merge + width);
+    size_t end = PieceBegin(count, runs, 2 * width * (merge + 1));
+    for (size_t k = 0; k <= splits; ++k) {
+      size_t diagonal = PieceBegin(end - begin, splits, k);
+      cuts[merge * (splits + 1) + k] = MergePathSplit(src + begin, middle - begin, src + middle, end - middle, diagonal, comp);
+    }
+  }
+
+  ParallelFor(pool, merges * splits, [&](size_t job) {
+    size_t merge = job / splits;
+    size_t k = job % splits;
+    size_t begin = PieceBegin(count, runs, 2 * width * merge);
+    size_t middle = PieceBegin(count, runs, 2 * width * merge + width);
+    size_t end = PieceBegin(count, runs, 2 * width * (merge + 1));
+    size_t out_begin = PieceBegin(end - begin, splits, k);
+    size_t out_end = PieceBegin(end - begin, splits, k + 1);
+    size_t a_begin = cuts[merge * (splits + 1) + k];
+    size_t a_end = cuts[merge * (splits + 1) + k + 1];
+
+    std::merge(std::make_move_iterator(src + begin + a_begin), std::make_move_iterator(src + begin + a_end),
+               std::make_move_iterator(src + middle + (out_begin - a_begin)),
+               std::make_move_iterator(src + middle + (out_end - a_end)), dst + begin + out_begin, comp);
+  });
+}
+
+}  // namespace detail
+
+template <typename InputIt, typename OutputIt, typename UnaryOp>
+OutputIt ParallelTransform(ThreadPool& pool, InputIt first, InputIt last, OutputIt d_first, UnaryOp op,
+                           size_t cutoff = kParallelAlgorithmCutoff) {
+  size_t count = static_cast<size_t>(last - first);
+  size_t pieces = detail::PieceCount(pool, count, cutoff);
+  if (pieces == 1) {
+    return std::transform(first, last, d_first, op);
+  }
+
+  ParallelFor(pool, pieces, [&](size_t piece) {
+    size_t begin = detail::PieceBegin(count, pieces, piece);
+    size_t end = detail::PieceBegin(count, pieces, piece + 1);
+    std::transform(first + begin, first + end, d_first + begin, op);
+  });
+  return d_first + count;
+}
+
+// Writes op-prefix folds of [first, last) to d_first; d_first may equal first
+template <typename InputIt, typename OutputIt, typename BinaryOp = std::plus<>>
+OutputIt ParallelInclusiveScan(ThreadPool& pool, InputIt first, InputIt last, OutputIt d_first, BinaryOp op = {},
+                               size_t cutoff = kParallelAlgorithmCutoff) {
+  using T = std::iter_value_t<InputIt>;
+  size_t count = static_cast<size_t>(last - first);
+  size_t pieces = detail::PieceCount(pool, count, cutoff);
+  if (pieces == 1) {
+    return std::inclusive_scan(first, last, d_first, op);
+  }
+
+  ParallelFor(pool, pieces, [&](size_t piece) {
+    size_t begin = detail::PieceBegin(count, pieces, piece);
+    size_t end = detail::PieceBegin(count, pieces, piece + 1);
+    std::inclusive_scan(first + begin, first + end, d_first + begin, op);
+  });
+
+  // carries[p] folds every element before piece p + 1
+  std::vector<T> carries;
+  carries.reserve(pieces - 1);
+  carries.push_back(d_first[detail::PieceBegin(count, pieces, 1) - 1]);
+  for (size_t piece = 1; piece + 1 < pieces; ++piece) {
+    carries.push_back(op(carries.back(), d_first[detail::PieceBegin(count, pieces, piece + 1) - 1]));
+  }
+
+  ParallelFor(pool, pieces - 1, [&](size_t index) {
+    size_t begin = detail::PieceBegin(count, pieces, index + 1);
+    size_t end = detail::PieceBegin(count, pieces, index + 2);
+    const T& carry = carries[index];
+    for (size_t i = begin; i < end; ++i) {
+      d_first[i] = op(carry, d_first[i]);
+    }
+  });
+  return d_first + count;
+}
+
+template <typename RandomIt, typename Compare = std::less<>>
+void ParallelSort(ThreadPool& pool, RandomIt first, RandomIt last, Compare comp = {}, size_t cutoff = kParallelAlgorithmCutoff) {
+  using T = std::iter_value_t<RandomIt>;
+  size_t count = static_cast<size_t>(last - first);
+  size_t runs = std::bit_floor(detail::PieceCount(pool, count, cutoff));  // a power of two, so runs pair up each round
+  if (runs == 1) {
+    std::sort(first, last, comp);
+    return;
+  }
+
+  ParallelFor(pool, runs, [&](size_t run) {
+    std::sort(first + detail::PieceBegin(count, runs, run), first + detail::PieceBegin(count, runs, run + 1), comp);
+  });
+
+  std::vector<T> buffer(count);
+  bool in_buffer = false;
+  for (size_t width = 1; width < runs; width *= 2) {
+    if (in_buffer) {
+      detail::MergeRound(pool, buffer.begin(), first, count, runs, width, comp);
+    } else {
+      detail::MergeRound(pool, first, buffer.begin(), count, runs, width, comp);
+    }
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer) {
+    ParallelFor(pool, runs, [&](size_t run) {
+      size_t begin = detail::PieceBegin(count, runs, run);
+      size_t end = detail::PieceBegin(count, runs, run + 1);
+      std::move(buffer.begin() + begin, buffer.begin() + end, first + begin);
+    });
+  }
+}
@@ -0,0 +1,115 @@
+/**
+ * @file ParallelFor.hpp
+ * @brief Fork-join loop over an index range on ThreadPool, with the calling thread joining in.
+ * @details Indices are claimed in chunks of `grain` from a shared atomic cursor by the caller and by up to
+ *          GetThreadCount() helper jobs. The call returns once every index has been processed, so the body
+ *          may capture locals by reference. No Task graph is allocated: one shared state plus one pool job per helper.
+ * @note Safe to call from a pool worker: the caller drains the range itself if no helper gets to run
+ * @note The first exception thrown by the body is rethrown on the caller after all indices finish
+ *
+ * @code{.cpp}
+ * ParallelFor(pool, meshes.size(), [&](size_t i) { meshes[i].RebuildBounds(); });
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+#include "ThreadPool.hpp"
+
+namespace detail {
+
+struct ForkJoinState {
+  size_t count = 0;
+  size_t grain = 1;
+  void* body = nullptr;  // only dereferenced for claimed indices, which all finish before ParallelFor returns
+  void (*invoke)(void*, size_t) = nullptr;
+
+  std::atomic<size_t> next{0};
+  std::atomic<size_t> remaining{0};
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool done = false;
+  std::exception_ptr exception = nullptr;
+
+  void Drain() {
+    size_t finished = 0;
+    while (true) {
+      size_t begin = next.fetch_add(grain, std::memory_order_relaxed);
+      if (begin >= count) {
+        break;
+      }
+      size_t end = std::min(begin + grain, count);
+      for (size_t i = begin; i < end; ++i) {
+        try {
+          invoke(body, i);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (!exception) {
+            exception = std::current_exception();
+          }
+        }
+      }
+      finished += end - begin;
+    }
+
+    if (finished > 0 && remaining.fetch_sub(finished, std::memory_order_acq_rel) == finished) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+      }
+      cv.notify_all();
+    }
+  }
+};
+
+}  // namespace detail
+
+template <typename Fn>
+void ParallelFor(ThreadPool& pool, size_t count, Fn&& body, size_t grain = 1) {
+  if (count == 0) {
+    return;
+  }
+  grain = std::max<size_t>(grain, 1);
+
+  size_t chunks = (count + grain - 1) / grain;
+  size_t helpers = std::min(pool.GetThreadCount(), chunks - 1);
+  if (helpers == 0) {
+    for (size_t i = 0; i < count; ++i) {
+      body(i);
+    }
+    return;
+  }
+
+  using Body = std::remove_reference_t<Fn>;
+  auto state = std::make_shared<detail::ForkJoinState>();
+  state->count = count;
+  state->grain = grain;
+  state->body = const_cast<void*>(static_cast<const void*>(std::addressof(body)));
+  state->invoke = [](void* fn, size_t index) { (*static_cast<Body*>(fn))(index); };
+  state->remaining.store(count, std::memory_order_relaxed);
+
+  for (size_t i = 0; i < helpers; ++i) {
+    pool.Enqueue([state]() { state->Drain(); });
+  }
+
+  state->Drain();
+
+  {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&state] { return state->done; });
+  }
+
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+}
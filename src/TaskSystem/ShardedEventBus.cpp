@@ -0,0 +1,211 @@
+/**
+ * @file ShardedEventBus.cpp
+ * @brief Implementation of ShardedEventBus owner threads, mailboxes and ShardedEventHandle.
+ */
+
+#include "ShardedEventBus.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+void ShardedEventHandle::Unsubscribe() {
+  if (!active_) {
+    return;
+  }
+
+  active_->store(false, std::memory_order_relaxed);
+  if (auto bus = bus_.lock()) {
+    bus->PostErase(event_type_, target_, handler_id_);
+  }
+  active_.reset();
+}
+
+ShardedEventBus::Node* ShardedEventBus::Mailbox::Pop() {
+  Node* tail = tail_;
+  Node* next = tail->next.load(std::memory_order_acquire);
+
+  if (tail == &stub_) {
+    if (next == nullptr) {
+      return nullptr;
+    }
+    tail_ = next;
+    tail = next;
+    next = next->next.load(std::memory_order_acquire);
+  }
+
+  if (next != nullptr) {
+    tail_ = next;
+    return tail;
+  }
+
+  if (tail != head_.load(std::memory_order_acquire)) {
+    return nullptr;  // a producer swapped head_ but has not linked tail to its node yet
+  }
+
+  // tail is the last node; park the stub behind it so tail can be handed out
+  Push(&stub_);
+  next = tail->next.load(std::memory_order_acquire);
+  if (next != nullptr) {
+    tail_ = next;
+    return tail;
+  }
+  return nullptr;
+}
+
+void ShardedEventBus::Shard::Erase(std::type_index event_type, SubjectID target, uint64_t handler_id) {
+  auto type_it = handlers.find(event_type);
+  if (type_it == handlers.end()) {
+    return;
+  }
+  auto target_it = type_it->second.find(target);
+  if (target_it == type_it->second.end()) {
+    return;
+  }
+
+  auto& entries = target_it->second;
+  std::erase_if(entries, [handler_id](const HandlerEntry& entry) { return entry.id == handler_id; });
+  if (entries.empty()) {
+    type_it->second.erase(target_it);
+    if (type_it->second.empty()) {
+      handlers.erase(type_it);
+    }
+  }
+}
+
+ShardedEventBus::ShardedEventBus(size_t shard_count) {
+  shard_count = std::max<size_t>(shard_count, 1);
+  shards_.reserve(shard_count);
+  for (size_t i = 0; i < shard_count; ++i) {
+    auto shard = std::make_unique<Shard>();
+    shard->bus = this;
+    shard->index = i;
+    shards_.push_back(std::move(shard));
+  }
+
+  // Threads start once every shard exists, since any of them may post to any other
+  for (auto& shard : shards_) {
+    shard->thread = std::thread([this, raw = shard.get()]() { RunShard(*raw); });
+  }
+}
+
+ShardedEventBus::~ShardedEventBus() {
+  WaitIdle();
+
+  stopping_.store(true, std::memory_order_seq_cst);
+  for (auto& shard : shards_) {
+    shard->sleeping.store(false, std::memory_order_seq_cst);
+    shard->sleeping.notify_one();
+  }
+  for (auto& shard : shards_) {
+    shard->thread.join();
+  }
+
+  // Messages posted from outside while the bus was being destroyed are freed without running
+  for (auto& shard : shards_) {
+    while (Node* node = shard->mailbox.Pop()) {
+      node->run(node, nullptr);
+    }
+  }
+}
+
+void ShardedEventBus::PostErase(std::type_index event_type, SubjectID target, uint64_t handler_id) {
+  Post(ShardOf(target), [event_type, target, handler_id](Shard& shard) { shard.Erase(event_type, target, handler_id); });
+}
+
+bool ShardedEventBus::RunLocal(Shard& shard) {
+  bool ran = false;
+  while (Node* node = shard.local_head) {
+    shard.local_head = node->next.load(std::memory_order_relaxed);
+    if (shard.local_head == nullptr) {
+      shard.local_tail = nullptr;
+    }
+    node->run(node, &shard);
+    shard.handled.store(shard.handled.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    ran = true;
+  }
+  return ran;
+}
+
+void ShardedEventBus::RunShard(Shard& shard) {
+  current_shard_ = &shard;
+
+  while (true) {
+    bool ran = false;
+    while (Node* node = shard.mailbox.Pop()) {
+      node->run(node, &shard);
+      shard.handled.store(shard.handled.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+      ran = true;
+      RunLocal(shard);
+    }
+    ran |= RunLocal(shard);
+    if (ran) {
+      continue;
+    }
+
+    // Announce the sleep before the last emptiness check; Post checks the flag after pushing (Dekker-style)
+    shard.sleeping.store(true, std::memory_order_seq_cst);
+    if (shard.mailbox.Pending()) {
+      shard.sleeping.store(false, std::memory_order_relaxed);
+      std::this_thread::yield();  // usually a producer between its exchange and its link
+      continue;
+    }
+    if (stopping_.load(std::memory_order_seq_cst)) {
+      break;
+    }
+
+    idle_epoch_.fetch_add(1, std::memory_order_seq_cst);
+    if (idle_waiters_.load(std::memory_order_seq_cst) != 0) {
+      idle_epoch_.notify_all();
+    }
+    shard.sleeping.wait(true, std::memory_order_seq_cst);
+  }
+
+  current_shard_ = nullptr;
+}
+
+bool ShardedEventBus::IsIdle() const {
+  // Two passes: a message handled between them changes a handled count, and one posted after a shard was read in
+  // the first pass comes from a handler that was still running, so its shard was not balanced then
+  std::vector<uint64_t> handled(shards_.size());
+  for (size_t i = 0; i < shards_.size(); ++i) {
+    const Shard& shard = *shards_[i];
+    handled[i] = shard.handled.load(std::memory_order_acquire);
+    if (shard.remote_posted.load(std::memory_order_acquire) + shard.local_posted.load(std::memory_order_acquire) != handled[i]) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < shards_.size(); ++i) {
+    const Shard& shard = *shards_[i];
+    if (shard.handled.load(std::memory_order_acquire) != handled[i] ||
+        shard.remote_posted.load(std::memory_order_acquire) + shard.local_posted.load(std::memory_order_acquire) != handled[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ShardedEventBus::WaitIdle() {
+  if (CurrentShard()) {
+    throw std::logic_error("ShardedEventBus::WaitIdle called from an owner thread");
+  }
+
+  idle_waiters_.fetch_add(1, std::memory_order_seq_cst);
+  while (true) {
+    uint64_t epoch = idle_epoch_.load(std::memory_order_seq_cst);
+    if (IsIdle()) {
+      break;
+    }
+    idle_epoch_.wait(epoch, std::memory_order_seq_cst);
+  }
+  idle_waiters_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::vector<ShardedEventBus::ShardStats> ShardedEventBus::GetStats() const {
+  std::vector<ShardStats> stats;
+  stats.reserve(shards_.size());
+  for (const auto& shard : shards_) {
+    stats.push_back(ShardStats{shard->delivered.load(std::memory_order_relaxed), shard->local_posted.load(std::memory_order_relaxed),
+                               shard->remote_posted.load(std::memory_order_relaxed)});
+  }
+  return stats;
+}
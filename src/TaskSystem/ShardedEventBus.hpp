@@ -0,0 +1,286 @@
+/**
+ * @file ShardedEventBus.hpp
+ * @brief Targeted-only event bus partitioned by SubjectID across shards, each owned by one thread.
+ * @details A subject belongs to shard ShardOf(target). Each shard has its own owner thread, its own handler table and
+ *          its own mailbox. Only the owner thread reads or writes the table, so dispatch takes no lock and a handler
+ *          can update per-entity state without synchronization.
+ *          - Emits and subscription changes are messages posted to the owning shard's mailbox. The mailbox is an
+ *            intrusive MPSC queue: a producer does one atomic exchange and never waits.
+ *          - A message posted by a shard's own thread goes to a plain local queue with no atomics. Entity-to-entity
+ *            traffic inside a shard never touches shared memory.
+ *          - Messages from one thread to one shard are handled in the order they were posted. So Subscribe followed
+ *            by EmitTargeted from the same thread delivers the event.
+ *          - Emits are asynchronous. WaitIdle returns once every mailbox has drained, including messages posted by
+ *            handlers while draining.
+ * @note Create it with std::make_shared so handles can reach it. Destroy it from outside its shards: the destructor
+ *       waits for idle and joins the owner threads.
+ * @note As with EventBus, a handler may still be running on its owner thread when Unsubscribe returns on another
+ *       thread. Events that are still queued are not delivered to it.
+ *
+ * @code{.cpp}
+ * auto bus = std::make_shared<ShardedEventBus>(4);
+ * auto handle = bus->SubscribeTargeted<DamageEvent>(SubjectID(id), [&world, id](const DamageEvent& event) {
+ *   world.health[id] -= event.amount;  // runs on ShardOf(id)'s thread only
+ * });
+ * bus->EmitTargeted(DamageEvent{.amount = 5}, SubjectID(id));
+ * bus->WaitIdle();
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "CacheLine.hpp"
+#include "Event.hpp"
+#include "SubjectID.hpp"
+
+class ShardedEventBus;
+
+class ShardedEventHandle {
+ public:
+  ShardedEventHandle(std::weak_ptr<ShardedEventBus> bus, std::type_index event_type, SubjectID target, uint64_t handler_id,
+                     std::shared_ptr<std::atomic<bool>> active)
+      : bus_(std::move(bus)), event_type_(event_type), target_(target), handler_id_(handler_id), active_(std::move(active)) {
+  }
+
+  ~ShardedEventHandle() {
+    Unsubscribe();
+  }
+
+  void Unsubscribe();
+
+  ShardedEventHandle(ShardedEventHandle&&) = default;
+  ShardedEventHandle& operator=(ShardedEventHandle&&) = default;
+
+  ShardedEventHandle(const ShardedEventHandle&) = delete;
+  ShardedEventHandle& operator=(const ShardedEventHandle&) = delete;
+
+ private:
+  std::weak_ptr<ShardedEventBus> bus_;
+  std::type_index event_type_;
+  SubjectID target_;
+  uint64_t handler_id_;
+  std::shared_ptr<std::atomic<bool>> active_;  // null once unsubscribed or moved from
+};
+
+class ShardedEventBus : public std::enable_shared_from_this<ShardedEventBus> {
+ public:
+  // Counters of one shard. They are read without stopping it, so they are only exact once the bus is idle
+  struct ShardStats {
+    uint64_t delivered = 0;     // handler invocations
+    uint64_t local_posts = 0;   // messages posted by the shard's own thread
+    uint64_t remote_posts = 0;  // messages that came through the mailbox
+  };
+
+  explicit ShardedEventBus(size_t shard_count = std::thread::hardware_concurrency());
+  ~ShardedEventBus();
+
+  size_t GetShardCount() const {
+    return shards_.size();
+  }
+
+  // Fibonacci hashing, so consecutive ids spread over the shards instead of following the low bits
+  size_t ShardOf(SubjectID target) const {
+    return static_cast<size_t>((target.value * 0x9E3779B97F4A7C15ull) >> 32) % shards_.size();
+  }
+
+  // The shard owned by the calling thread, or nullopt outside this bus's owner threads
+  std::optional<size_t> CurrentShard() const {
+    if (current_shard_ != nullptr && current_shard_->bus == this) {
+      return current_shard_->index;
+    }
+    return std::nullopt;
+  }
+
+  template <typename E>
+    requires EventType<E>
+  ShardedEventHandle SubscribeTargeted(SubjectID target, std::function<void(const E&)> handler) {
+    std::type_index type_id(typeid(E));
+    uint64_t handler_id = next_handler_id_.fetch_add(1, std::memory_order_relaxed);
+    auto active = std::make_shared<std::atomic<bool>>(true);
+
+    Post(ShardOf(target), [type_id, target, handler_id, active, handler = std::move(handler)](Shard& shard) mutable {
+      shard.handlers[type_id][target].push_back(HandlerEntry{
+        handler_id, std::move(active), [handler = std::move(handler)](const void* event) { handler(*static_cast<const E*>(event)); }});
+    });
+
+    return ShardedEventHandle(weak_from_this(), type_id, target, handler_id, std::move(active));
+  }
+
+  // Queues event for target's handlers on the owning shard and returns immediately
+  template <typename E>
+    requires EventType<E>
+  void EmitTargeted(const E& event, SubjectID target) {
+    Post(ShardOf(target), [event, target](Shard& shard) { shard.Dispatch(event, target); });
+  }
+
+  /**
+   * @brief Blocks until every shard has handled every message, including messages posted while waiting
+   * @throws std::logic_error when called from one of this bus's owner threads, which would wait on itself
+   */
+  void WaitIdle();
+
+  std::vector<ShardStats> GetStats() const;
+
+  ShardedEventBus(const ShardedEventBus&) = delete;
+  ShardedEventBus& operator=(const ShardedEventBus&) = delete;
+
+ private:
+  friend class ShardedEventHandle;
+
+  struct Shard;
+
+  // Intrusive message; run invokes the payload on shard (unless null, at teardown) and frees the node
+  struct Node {
+    std::atomic<Node*> next{nullptr};
+    void (*run)(Node*, Shard*) = nullptr;
+  };
+
+  template <typename F>
+  struct FunctionNode : Node {
+    explicit FunctionNode(F&& f) : fn(std::move(f)) {
+      run = [](Node* node, Shard* shard) {
+        auto* self = static_cast<FunctionNode*>(node);
+        if (shard != nullptr) {
+          self->fn(*shard);
+        }
+        delete self;
+      };
+    }
+
+    F fn;
+  };
+
+  // Vyukov's intrusive MPSC queue: producers exchange head_ and link, the single consumer follows next from tail_
+  class Mailbox {
+   public:
+    Mailbox() : head_(&stub_), tail_(&stub_) {
+    }
+
+    void Push(Node* node) {
+      node->next.store(nullptr, std::memory_order_relaxed);
+      Node* previous = head_.exchange(node, std::memory_order_seq_cst);
+      previous->next.store(node, std::memory_order_release);
+    }
+
+    // Consumer side; nullptr when empty or when the only pending producer has not linked its node yet
+    Node* Pop();
+
+    // Consumer side; true while a pushed node is not yet consumed, including one whose link is still in flight
+    bool Pending() const {
+      return head_.load(std::memory_order_seq_cst) != tail_ || tail_->next.load(std::memory_order_acquire) != nullptr;
+    }
+
+   private:
+    alignas(kCacheLineSize) std::atomic<Node*> head_;
+    alignas(kCacheLineSize) Node* tail_;
+    Node stub_;
+  };
+
+  using TypeErasedHandler = std::function<void(const void*)>;
+
+  struct HandlerEntry {
+    uint64_t id;
+    std::shared_ptr<std::atomic<bool>> active;  // cleared by Unsubscribe; the entry is erased by a later message
+    TypeErasedHandler handler;
+  };
+
+  struct Shard {
+    ShardedEventBus* bus = nullptr;
+    size_t index = 0;
+
+    // Written by producers
+    Mailbox mailbox;
+    alignas(kCacheLineSize) std::atomic<uint64_t> remote_posted{0};
+    alignas(kCacheLineSize) std::atomic<bool> sleeping{false};
+
+    // Written by the owner thread only; atomics so that WaitIdle and GetStats can read them
+    alignas(kCacheLineSize) std::atomic<uint64_t> local_posted{0};
+    std::atomic<uint64_t> handled{0};
+    std::atomic<uint64_t> delivered{0};
+
+    // Owner thread only
+    Node* local_head = nullptr;
+    Node* local_tail = nullptr;
+    std::unordered_map<std::type_index, std::unordered_map<SubjectID, std::vector<HandlerEntry>>> handlers;
+
+    std::thread thread;
+
+    template <typename E>
+    void Dispatch(const E& event, SubjectID target) {
+      auto type_it = handlers.find(std::type_index(typeid(E)));
+      if (type_it == handlers.end()) {
+        return;
+      }
+      auto target_it = type_it->second.find(target);
+      if (target_it == type_it->second.end()) {
+        return;
+      }
+
+      // Handlers cannot change this list while it is walked: subscription changes are messages of their own
+      uint64_t count = 0;
+      for (auto& entry : target_it->second) {
+        if (!entry.active->load(std::memory_order_relaxed)) {
+          continue;
+        }
+        try {
+          entry.handler(&event);
+        } catch (const std::exception&) {
+        }
+        ++count;
+      }
+      delivered.store(delivered.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+    }
+
+    void Erase(std::type_index event_type, SubjectID target, uint64_t handler_id);
+  };
+
+  template <typename F>
+  void Post(size_t shard_index, F&& fn) {
+    Node* node = new FunctionNode<std::decay_t<F>>(std::forward<F>(fn));
+    Shard& shard = *shards_[shard_index];
+
+    if (current_shard_ == &shard) {
+      if (shard.local_tail != nullptr) {
+        shard.local_tail->next.store(node, std::memory_order_relaxed);
+      } else {
+        shard.local_head = node;
+      }
+      shard.local_tail = node;
+      shard.local_posted.store(shard.local_posted.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+      return;
+    }
+
+    shard.remote_posted.fetch_add(1, std::memory_order_release);
+    shard.mailbox.Push(node);
+    if (shard.sleeping.load(std::memory_order_seq_cst) && shard.sleeping.exchange(false, std::memory_order_seq_cst)) {
+      shard.sleeping.notify_one();
+    }
+  }
+
+  void PostErase(std::type_index event_type, SubjectID target, uint64_t handler_id);
+
+  void RunShard(Shard& shard);
+  bool RunLocal(Shard& shard);
+  bool IsIdle() const;
+
+  static inline thread_local Shard* current_shard_ = nullptr;
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::atomic<uint64_t> next_handler_id_{1};
+  std::atomic<bool> stopping_{false};
+
+  // Bumped by a shard each time it runs out of work; WaitIdle sleeps on it between idle checks
+  std::atomic<uint64_t> idle_epoch_{0};
+  std::atomic<uint32_t> idle_waiters_{0};
+};
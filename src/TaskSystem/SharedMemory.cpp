@@ -0,0 +1,291 @@
+/**
+ * @file SharedMemory.cpp
+ * @brief Implementation of SharedMemoryRegion and MappedFile for Windows and POSIX.
+ */
+
+#include "SharedMemory.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#ifndef _WIN32
+std::string PosixName(const std::string& name) {
+  return name.starts_with('/') ? name : "/" + name;
+}
+#endif
+
+}  // namespace
+
+SharedMemoryRegion SharedMemoryRegion::Create(const std::string& name, size_t size) {
+  SharedMemoryRegion region;
+  region.name_ = name;
+  region.size_ = size;
+  region.owner_ = true;
+
+#ifdef _WIN32
+  auto size64 = static_cast<unsigned long long>(size);
+  HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE,
+    nullptr,
+    PAGE_READWRITE,
+    static_cast<DWORD>(size64 >> 32),
+    static_cast<DWORD>(size64 & 0xFFFFFFFFull),
+    name.c_str());
+  if (!mapping) {
+    throw std::runtime_error("SharedMemoryRegion: CreateFileMapping failed for " + name);
+  }
+  region.handle_ = mapping;
+  region.data_ = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+#else
+  std::string posix_name = PosixName(name);
+  int fd = shm_open(posix_name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0600);
+  if (fd < 0) {
+    throw std::runtime_error("SharedMemoryRegion: shm_open failed for " + name);
+  }
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    close(fd);
+    shm_unlink(posix_name.c_str());
+    throw std::runtime_error("SharedMemoryRegion: ftruncate failed for " + name);
+  }
+  void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  region.data_ = data == MAP_FAILED ? nullptr : data;
+#endif
+
+  if (!region.data_) {
+    throw std::runtime_error("SharedMemoryRegion: mapping failed for " + name);
+  }
+  return region;
+}
+
+SharedMemoryRegion SharedMemoryRegion::Open(const std::string& name, size_t size) {
+  SharedMemoryRegion region;
+  region.name_ = name;
+  region.size_ = size;
+
+#ifdef _WIN32
+  HANDLE mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name.c_str());
+  if (!mapping) {
+    throw std::runtime_error("SharedMemoryRegion: OpenFileMapping failed for " + name);
+  }
+  region.handle_ = mapping;
+  region.data_ = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+#else
+  int fd = shm_open(PosixName(name).c_str(), O_RDWR, 0600);
+  if (fd < 0) {
+    throw std::runtime_error("SharedMemoryRegion: shm_open failed for " + name);
+  }
+  void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  region.data_ = data == MAP_FAILED ? nullptr : data;
+#endif
+
+  if (!region.data_) {
+    throw std::runtime_error("SharedMemoryRegion: mapping failed for " + name);
+  }
+  return region;
+}
+
+SharedMemoryRegion::~SharedMemoryRegion() {
+  Release();
+}
+
+SharedMemoryRegion::SharedMemoryRegion(SharedMemoryRegion&& other) noexcept
+    : name_(std::move(other.name_)),
+      data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      owner_(std::exchange(other.owner_, false)),
+      handle_(std::exchange(other.handle_, nullptr)) {
+}
+
+SharedMemoryRegion& SharedMemoryRegion::operator=(SharedMemoryRegion&& other) noexcept {
+  if (this != &other) {
+    Release();
+    name_ = std::move(other.name_);
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    owner_ = std::exchange(other.owner_, false);
+    handle_ = std::exchange(other.handle_, nullptr);
+  }
+  return *this;
+}
+
+void SharedMemoryRegion::Release() {
+#ifdef _WIN32
+  if (data_) {
+    UnmapViewOfFile(data_);
+  }
+  if (handle_) {
+    CloseHandle(static_cast<HANDLE>(handle_));
+  }
+#else
+  if (data_) {
+    munmap(data_, size_);
+  }
+  if (owner_) {
+    shm_unlink(PosixName(name_).c_str());
+  }
+#endif
+  data_ = nullptr;
+  handle_ = nullptr;
+  owner_ = false;
+}
+
+MappedFile MappedFile::Create(const std::string& path, size_t initial_capacity) {
+  MappedFile file;
+  file.path_ = path;
+
+#ifdef _WIN32
+  HANDLE handle = CreateFileA(
+    path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (handle == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error("MappedFile: CreateFile failed for " + path);
+  }
+  file.file_ = handle;
+#else
+  file.fd_ = open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+  if (file.fd_ < 0) {
+    throw std::runtime_error("MappedFile: open failed for " + path);
+  }
+#endif
+
+  if (!file.Grow(std::max<size_t>(initial_capacity, 1))) {
+    throw std::runtime_error("MappedFile: mapping failed for " + path);
+  }
+  return file;
+}
+
+MappedFile::~MappedFile() {
+  Release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : path_(std::move(other.path_)),
+      data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      capacity_(std::exchange(other.capacity_, 0)),
+      fd_(std::exchange(other.fd_, -1)),
+      file_(std::exchange(other.file_, nullptr)),
+      mapping_(std::exchange(other.mapping_, nullptr)) {
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    Release();
+    path_ = std::move(other.path_);
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    capacity_ = std::exchange(other.capacity_, 0);
+    fd_ = std::exchange(other.fd_, -1);
+    file_ = std::exchange(other.file_, nullptr);
+    mapping_ = std::exchange(other.mapping_, nullptr);
+  }
+  return *this;
+}
+
+bool MappedFile::Append(const void* data, size_t size) {
+  if (size_ + size > capacity_ && !Grow(std::max(capacity_ * 2, size_ + size))) {
+    return false;
+  }
+  std::memcpy(static_cast<std::byte*>(data_) + size_, data, size);
+  size_ += size;
+  return true;
+}
+
+// Extends the file and maps the new size before dropping the old view, so a failure leaves the old view intact
+bool MappedFile::Grow(size_t capacity) {
+#ifdef _WIN32
+  LARGE_INTEGER end;
+  end.QuadPart = static_cast<LONGLONG>(capacity);
+  if (!SetFilePointerEx(static_cast<HANDLE>(file_), end, nullptr, FILE_BEGIN) || !SetEndOfFile(static_cast<HANDLE>(file_))) {
+    return false;
+  }
+  HANDLE mapping = CreateFileMappingA(static_cast<HANDLE>(file_), nullptr, PAGE_READWRITE, 0, 0, nullptr);
+  if (!mapping) {
+    return false;
+  }
+  void* data = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, capacity);
+  if (!data) {
+    CloseHandle(mapping);
+    return false;
+  }
+  if (data_) {
+    UnmapViewOfFile(data_);
+  }
+  if (mapping_) {
+    CloseHandle(static_cast<HANDLE>(mapping_));
+  }
+  mapping_ = mapping;
+#else
+  // Reserve the blocks up front: a sparse extension would turn a full disk into SIGBUS on a later store
+#ifdef __linux__
+  if (posix_fallocate(fd_, 0, static_cast<off_t>(capacity)) != 0) {
+    return false;
+  }
+#else
+  if (ftruncate(fd_, static_cast<off_t>(capacity)) != 0) {
+    return false;
+  }
+#endif
+  void* data = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  if (data_) {
+    munmap(data_, capacity_);
+  }
+#endif
+  data_ = data;
+  capacity_ = capacity;
+  return true;
+}
+
+void MappedFile::Release() {
+#ifdef _WIN32
+  if (data_) {
+    UnmapViewOfFile(data_);
+  }
+  if (mapping_) {
+    CloseHandle(static_cast<HANDLE>(mapping_));
+  }
+  if (file_) {
+    LARGE_INTEGER end;
+    end.QuadPart = static_cast<LONGLONG>(size_);
+    SetFilePointerEx(static_cast<HANDLE>(file_), end, nullptr, FILE_BEGIN);
+    SetEndOfFile(static_cast<HANDLE>(file_));
+    CloseHandle(static_cast<HANDLE>(file_));
+  }
+#else
+  if (data_) {
+    munmap(data_, capacity_);
+  }
+  if (fd_ >= 0) {
+    // A failed trim only leaves zeroed slack past Size() behind
+    [[maybe_unused]] int trimmed = ftruncate(fd_, static_cast<off_t>(size_));
+    close(fd_);
+  }
+#endif
+  data_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
+  fd_ = -1;
+  file_ = nullptr;
+  mapping_ = nullptr;
+}
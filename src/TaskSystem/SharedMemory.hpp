@@ -0,0 +1,97 @@
+/**
+ * @file SharedMemory.hpp
+ * @brief Named shared memory regions and append-only mapped files.
+ * @details Thin RAII wrappers over POSIX shm_open/open/mmap and Win32 CreateFileMapping/MapViewOfFile.
+ *          SharedMemoryRegion: the creating side owns the name and removes it on destruction (POSIX); openers only unmap.
+ *          MappedFile: a file written through its mapping, grown (and remapped) in doubling steps as it fills and
+ *          trimmed to the bytes actually appended when closed.
+ *
+ * @code{.cpp}
+ * auto region = SharedMemoryRegion::Create("sim-to-tools", 1 << 20);  // simulation process
+ * auto view = SharedMemoryRegion::Open("sim-to-tools", 1 << 20);      // tooling process
+ *
+ * auto log = MappedFile::Create("session.evlog", 1 << 20);
+ * if (!log.Append(bytes.data(), bytes.size())) { ... }  // the file could not grow (disk full)
+ * @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+class SharedMemoryRegion {
+ public:
+  // Creates (or truncates) the named region; throws std::runtime_error on failure
+  static SharedMemoryRegion Create(const std::string& name, size_t size);
+
+  // Maps an existing named region; throws std::runtime_error on failure
+  static SharedMemoryRegion Open(const std::string& name, size_t size);
+
+  ~SharedMemoryRegion();
+
+  SharedMemoryRegion(SharedMemoryRegion&& other) noexcept;
+  SharedMemoryRegion& operator=(SharedMemoryRegion&& other) noexcept;
+
+  SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+  SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+  void* Data() const {
+    return data_;
+  }
+
+  size_t Size() const {
+    return size_;
+  }
+
+ private:
+  SharedMemoryRegion() = default;
+  void Release();
+
+  std::string name_;
+  void* data_ = nullptr;
+  size_t size_ = 0;
+  bool owner_ = false;
+  void* handle_ = nullptr;  // HANDLE of the file mapping on Windows, unused on POSIX
+};
+
+class MappedFile {
+ public:
+  // Creates (or truncates) the file at path and maps initial_capacity bytes of it; throws std::runtime_error on failure
+  static MappedFile Create(const std::string& path, size_t initial_capacity);
+
+  ~MappedFile();
+
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // Copies size bytes to the end of the file, growing it when full.
+  // Returns false and appends nothing if the file cannot grow; the existing contents stay mapped and valid.
+  bool Append(const void* data, size_t size);
+
+  // Start of the appended bytes; invalidated by the next Append that grows the file
+  std::byte* Data() const {
+    return static_cast<std::byte*>(data_);
+  }
+
+  // Bytes appended so far (the file on disk is longer until it is closed)
+  size_t Size() const {
+    return size_;
+  }
+
+ private:
+  MappedFile() = default;
+  bool Grow(size_t capacity);
+  void Release();
+
+  std::string path_;
+  void* data_ = nullptr;
+  size_t size_ = 0;
+  size_t capacity_ = 0;
+  int fd_ = -1;              // POSIX file descriptor, unused on Windows
+  void* file_ = nullptr;     // HANDLE of the file on Windows, unused on POSIX
+  void* mapping_ = nullptr;  // HANDLE of the file mapping on Windows, unused on POSIX
+};
@@ -0,0 +1,171 @@
+/**
+ * @file SpscRing.hpp
+ * @brief Lock-free single-producer/single-consumer ring of variable-size frames over caller-provided memory.
+ * @details The control block (head/tail cursors on separate cache lines) and the frame storage live inside the
+ *          given memory, so the ring works over a SharedMemoryRegion between processes as well as over heap memory.
+ *          Frames are `[uint32 size][payload]` padded to 8 bytes; a wrap marker skips the unused tail of the buffer.
+ * @note Exactly one thread may push and one thread may pop at a time
+ * @note Relies on lock-free std::atomic<uint64_t>, which is address-free and therefore valid in shared memory
+ *
+ * @code{.cpp}
+ * auto region = SharedMemoryRegion::Create("bus-bridge", SpscRing::RequiredBytes(1 << 20));
+ * SpscRing producer = SpscRing::Initialize(region.Data(), region.Size());
+ * SpscRing consumer = SpscRing::Attach(other_mapping.Data());
+ * producer.TryPush(bytes.data(), bytes.size());
+ * consumer.TryPop(frame);
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include "CacheLine.hpp"
+
+class SpscRing {
+ public:
+  // Bytes of memory needed for a ring whose frame storage holds `capacity` bytes (rounded up to a power of two)
+  static size_t RequiredBytes(size_t capacity) {
+    return sizeof(ControlBlock) + RoundUpPowerOfTwo(capacity);
+  }
+
+  // Formats memory as an empty ring; call once, on the creating side
+  static SpscRing Initialize(void* memory, size_t bytes) {
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "SpscRing needs lock-free 64-bit atomics");
+    if (bytes < sizeof(ControlBlock) + kMinCapacity) {
+      throw std::invalid_argument("SpscRing: region too small");
+    }
+
+    size_t capacity = bytes - sizeof(ControlBlock);
+    while ((capacity & (capacity - 1)) != 0) {
+      capacity &= capacity - 1;  // largest power of two that fits
+    }
+
+    auto* control = new (memory) ControlBlock();
+    control->capacity = capacity;
+    control->magic = kMagic;
+    return SpscRing(control);
+  }
+
+  // Attaches to a ring formatted by Initialize, e.g. from another process
+  static SpscRing Attach(void* memory) {
+    auto* control = std::launder(static_cast<ControlBlock*>(memory));
+    if (control->magic != kMagic) {
+      throw std::invalid_argument("SpscRing: memory is not an initialized ring");
+    }
+    return SpscRing(control);
+  }
+
+  // Largest payload a single frame can carry
+  size_t MaxFrameSize() const {
+    return control_->capacity / 2 - sizeof(uint32_t);
+  }
+
+  // Producer side; returns false when the ring is full or the frame is too large
+  bool TryPush(const void* data, size_t size) {
+    if (size > MaxFrameSize()) {
+      return false;
+    }
+
+    const uint64_t capacity = control_->capacity;
+    const uint64_t frame = AlignFrame(sizeof(uint32_t) + size);
+    uint64_t head = control_->head.load(std::memory_order_relaxed);
+    const uint64_t tail = control_->tail.load(std::memory_order_acquire);
+
+    uint64_t index = head & (capacity - 1);
+    uint64_t contiguous = capacity - index;
+    uint64_t needed = frame > contiguous ? contiguous + frame : frame;
+    if (needed > capacity - (head - tail)) {
+      return false;
+    }
+
+    if (frame > contiguous) {
+      WriteSize(index, kWrapMarker);
+      head += contiguous;
+      index = 0;
+    }
+
+    WriteSize(index, static_cast<uint32_t>(size));
+    std::memcpy(Storage() + index + sizeof(uint32_t), data, size);
+    control_->head.store(head + frame, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side; returns false when the ring is empty
+  bool TryPop(std::vector<std::byte>& out) {
+    const uint64_t capacity = control_->capacity;
+    uint64_t tail = control_->tail.load(std::memory_order_relaxed);
+    const uint64_t head = control_->head.load(std::memory_order_acquire);
+
+    if (tail == head) {
+      return false;
+    }
+
+    uint64_t index = tail & (capacity - 1);
+    uint32_t size = ReadSize(index);
+    if (size == kWrapMarker) {
+      tail += capacity - index;
+      index = 0;
+      size = ReadSize(index);
+    }
+
+    out.resize(size);
+    std::memcpy(out.data(), Storage() + index + sizeof(uint32_t), size);
+    control_->tail.store(tail + AlignFrame(sizeof(uint32_t) + size), std::memory_order_release);
+    return true;
+  }
+
+  bool Empty() const {
+    return control_->head.load(std::memory_order_acquire) == control_->tail.load(std::memory_order_acquire);
+  }
+
+ private:
+  static constexpr uint64_t kMagic = 0x53505343'52494E47ull;  // "SPSCRING"
+  static constexpr uint32_t kWrapMarker = 0xFFFFFFFFu;
+  static constexpr size_t kMinCapacity = 64;
+
+  // Cursors are monotonic byte positions; producer and consumer each own one cache line
+  struct ControlBlock {
+    alignas(kCacheLineSize) std::atomic<uint64_t> head{0};
+    alignas(kCacheLineSize) std::atomic<uint64_t> tail{0};
+    alignas(kCacheLineSize) uint64_t capacity = 0;
+    uint64_t magic = 0;
+  };
+
+  explicit SpscRing(ControlBlock* control) : control_(control) {
+  }
+
+  static size_t RoundUpPowerOfTwo(size_t value) {
+    size_t result = kMinCapacity;
+    while (result < value) {
+      result <<= 1;
+    }
+    return result;
+  }
+
+  static uint64_t AlignFrame(uint64_t bytes) {
+    return (bytes + 7) & ~uint64_t{7};
+  }
+
+  std::byte* Storage() const {
+    return reinterpret_cast<std::byte*>(control_ + 1);
+  }
+
+  void WriteSize(uint64_t index, uint32_t size) {
+    std::memcpy(Storage() + index, &size, sizeof(size));
+  }
+
+  uint32_t ReadSize(uint64_t index) const {
+    uint32_t size;
+    std::memcpy(&size, Storage() + index, sizeof(size));
+    return size;
+  }
+
+  ControlBlock* control_;
+};
@@ -0,0 +1,84 @@
+/**
+ * @file StaticEventBus.hpp
+ * @brief Compile-time event dispatch for handler sets known at build time.
+ * @details StaticEventBus<Handlers...> stores its handlers by value in a tuple. Emit<E> expands, at compile time,
+ *          to a direct call to every handler invocable with `const E&`, so there is no registry lookup, lock,
+ *          snapshot or std::function indirection and the compiler can inline the calls.
+ *          Uses the same EventType concept as EventBus, so one event struct can flow through both: core engine
+ *          subscribers live in the static bus, runtime subscribers (tools, scripts) stay on the dynamic one.
+ * @note Handlers run in declaration order; like EventBus::Emit, a std::exception from one handler does not stop the others
+ * @note A handler with a generic `operator()(const auto&)` receives every event type
+ *
+ * @code{.cpp}
+ * struct AudioSystem {
+ *   void operator()(const PlayerDamagedEvent& event) { PlayHurtSound(event.player_id); }
+ * };
+ * struct HudSystem {
+ *   void operator()(const PlayerDamagedEvent& event) { FlashHealthBar(event.damage); }
+ *   void operator()(const SceneLoadedEvent& event) { ShowTitle(event.scene_name); }
+ * };
+ *
+ * StaticEventBus<AudioSystem, HudSystem> core_bus;
+ * core_bus.Emit(PlayerDamagedEvent{.player_id = 1, .damage = 25.0f});  // inlined calls, no registry
+ * dynamic_bus->Emit(PlayerDamagedEvent{.player_id = 1, .damage = 25.0f});  // runtime subscribers
+ * @endcode
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <tuple>
+#include <utility>
+
+#include "Event.hpp"
+
+template <typename... Handlers>
+class StaticEventBus {
+ public:
+  StaticEventBus()
+    requires(std::default_initializable<Handlers> && ...)
+  = default;
+
+  explicit StaticEventBus(Handlers... handlers)
+    requires(sizeof...(Handlers) > 0)
+      : handlers_(std::move(handlers)...) {
+  }
+
+  template <typename E>
+    requires EventType<E>
+  void Emit(const E& event) {
+    std::apply([&event](auto&... handler) { (Dispatch(handler, event), ...); }, handlers_);
+  }
+
+  // Number of handlers that receive E, resolved at compile time
+  template <typename E>
+    requires EventType<E>
+  static constexpr size_t HandlerCount() {
+    return (size_t{0} + ... + (std::invocable<Handlers&, const E&> ? size_t{1} : size_t{0}));
+  }
+
+  template <typename H>
+  H& Get() {
+    return std::get<H>(handlers_);
+  }
+
+  template <typename H>
+  const H& Get() const {
+    return std::get<H>(handlers_);
+  }
+
+ private:
+  template <typename H, typename E>
+  static void Dispatch(H& handler, const E& event) {
+    if constexpr (std::invocable<H&, const E&>) {
+      try {
+        handler(event);
+      } catch (const std::exception&) {
+      }
+    }
+  }
+
+  std::tuple<Handlers...> handlers_;
+};
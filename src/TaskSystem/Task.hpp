@@ -2,38 +2,115 @@
  * @file Task.hpp
  * @brief Task-based continuation primitives supporting success and failure continuations.
  * @details Defines Task<T> and Task<void> types with continuation support via `Then` (conditional on success) and `Finally`
- * (unconditional), exception propagation, and result retrieval.
+ * (unconditional), exception propagation, and result retrieval. `Then` also accepts a callable: on a Task<T> it receives
+ * the result by move and becomes the next stage, `task->Then([](T value) -> U {...})` returning a Task<U>.
  * @note Use `Then` for conditional continuations and `Finally` for unconditional continuations
+ * @note Results are read in place: Result() (and GetResult) return a const reference valid while the task lives, and
+ *       any number of readers may call them. SharedResult() hands out a refcounted pointer to the same storage for
+ *       consumers that outlive their handle to the task. TakeResult() moves the value out; after it, readers throw.
+ *       SharedResult and TakeResult may race each other; neither may race a reader still using a Result reference.
+ * @note A result forwarded into Then(fn) stages is moved out before the task reports done: every stage but the last
+ *       attached gets a copy, and readers then throw. A move-only result can be forwarded to one stage only.
+ * @note Then/Finally may be called while the predecessor runs or after it finished; a successor attached to a
+ *       finished task is notified immediately. To attach several edges to a task without it starting early,
+ *       hold it with AddPendingSignals(1) and release that signal once all edges are in place.
+ * @note SetDeadline routes a task through the pool's earliest-deadline-first lane; with DeadlinePolicy::CancelIfLate a
+ *       task that has not started by its deadline is skipped and fails with DeadlineExceededException.
+ * @note Tasks tracked by a TaskGraphProfiler record their timings and the edges they were released through.
+ * @note A task whose job is discarded by ThreadPool::Shutdown completes with TaskDiscardedException.
+ * @note Wait called from inside a Fiber parks the fiber instead of blocking the worker thread.
  */
 
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <concepts>
 #include <condition_variable>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "CacheLine.hpp"
+#include "CancellationToken.hpp"
 #include "ThreadPool.hpp"
 
 // Forward declaration for primary template
 template <typename T>
 class Task;
 
+// Stage created by Task<In>::Then(fn); defined after Task<T>
+template <typename In, typename Out>
+class StageTask;
+
+// What a task with a deadline does when it only gets a worker after that deadline
+enum class DeadlinePolicy {
+  RunLate,       // run anyway; the pool counts it as missed
+  CancelIfLate,  // skip the callback and fail with DeadlineExceededException, so Then successors are skipped too
+};
+
+class DeadlineExceededException : public TaskCancelledException {
+ public:
+  const char* what() const noexcept override {
+    return "Task missed its deadline before starting";
+  }
+};
+
+class TaskDiscardedException : public TaskCancelledException {
+ public:
+  const char* what() const noexcept override {
+    return "Task was discarded by a thread pool shutdown";
+  }
+};
+
+// Timing and edge record of a task tracked by a TaskGraphProfiler; shared so it outlives the task
+struct TaskProfileNode {
+  uint32_t id = 0;
+  std::string name;
+  std::atomic<int64_t> enqueued_ns{0};
+  std::atomic<int64_t> started_ns{0};
+  std::atomic<int64_t> finished_ns{0};
+  std::mutex predecessors_mutex;
+  std::vector<uint32_t> predecessors;  // tracked predecessors that released this task
+
+  static int64_t Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(ThreadPool::Clock::now().time_since_epoch()).count();
+  }
+
+  void AddPredecessor(uint32_t predecessor) {
+    std::lock_guard<std::mutex> lock(predecessors_mutex);
+    predecessors.push_back(predecessor);
+  }
+};
+
+class TaskBase;
+
+// Installed by Fiber on a worker while it runs a fiber; returns once the task is done, without blocking the thread
+inline thread_local void (*t_fiber_wait_hook)(TaskBase& task) = nullptr;
+
 class TaskBase {
  public:
   virtual ~TaskBase() = default;
 
   void Wait() {
+    if (t_fiber_wait_hook && !IsDone()) {
+      t_fiber_wait_hook(*this);
+      return;
+    }
     std::unique_lock<std::mutex> lock(wait_mutex_);
     wait_cv_.wait(lock, [this] { return is_done_.load(std::memory_order_acquire); });
   }
 
   void OnPredecessorFinished(ThreadPool& pool, std::exception_ptr predecessor_exception = nullptr) {
-    if (predecessor_exception && !exception_) {
+    if (predecessor_exception) {
       std::lock_guard<std::mutex> lock(exception_mutex_);
       if (!exception_) {
         exception_ = predecessor_exception;
@@ -53,33 +130,205 @@ class TaskBase {
     }
   }
 
+  // Registers count completion signals that are not Then/Finally edges; each one must be reported through
+  // OnPredecessorFinished before the task runs. Lets a single task act as an atomic countdown for plain pool jobs.
+  void AddPendingSignals(int count) {
+    predecessor_count_.fetch_add(count, std::memory_order_relaxed);
+  }
+
   bool IsDone() const {
     return is_done_.load(std::memory_order_acquire);
   }
 
+  // Schedules the task on the pool's deadline lane; call before the task can become ready
+  void SetDeadline(ThreadPool::Clock::time_point deadline, DeadlinePolicy policy = DeadlinePolicy::RunLate) {
+    deadline_ = deadline;
+    deadline_policy_ = policy;
+  }
+
+  bool HasDeadline() const {
+    return deadline_ != ThreadPool::Clock::time_point::max();
+  }
+
  protected:
   void NotifyFinished() {
-    is_done_.store(true, std::memory_order_release);
+    {
+      // Published under the waiters' mutex so a Wait between its predicate check and sleeping cannot miss it
+      std::lock_guard<std::mutex> lock(wait_mutex_);
+      is_done_.store(true, std::memory_order_release);
+    }
     wait_cv_.notify_all();
   }
 
+  void SetException(std::exception_ptr exception) {
+    std::lock_guard<std::mutex> lock(exception_mutex_);
+    exception_ = std::move(exception);
+  }
+
+  // Registers next as a successor, or notifies it right away if this task already notified its successors
+  void AddSuccessor(std::vector<std::shared_ptr<TaskBase>>& successors, std::shared_ptr<TaskBase> next, bool conditional) {
+    next->predecessor_count_.fetch_add(1, std::memory_order_relaxed);
+    {
+      std::lock_guard<std::mutex> lock(successors_mutex_);
+      if (!successors_notified_) {
+        successors.push_back(std::move(next));
+        return;
+      }
+    }
+    ProfileEdge(*next);
+    next->OnPredecessorFinished(*pool_, conditional ? exception_ : nullptr);
+  }
+
+  template <typename Job>
+  void EnqueueJob(ThreadPool& pool, Job&& job) {
+    if (profile_) {
+      profile_->enqueued_ns.store(TaskProfileNode::Now(), std::memory_order_relaxed);
+    }
+    ThreadPool::DiscardHook on_discard{&TaskBase::DiscardQueued, this};
+    if (HasDeadline()) {
+      pool.EnqueueWithDeadline(deadline_, std::forward<Job>(job), on_discard);
+    } else {
+      pool.Enqueue(std::forward<Job>(job), on_discard);
+    }
+  }
+
+  // Completes a task that will not run because its pool shut down; Then successors are skipped, Finally ones are
+  // scheduled and, on a pool that is discarding, discarded in turn
+  void CompleteDiscarded() {
+    SetException(std::make_exception_ptr(TaskDiscardedException()));
+    ProfileSkipped();
+    NotifyFinished();
+    NotifySuccessors(*pool_);
+  }
+
+  // Discard hook of a queued job; the job would have released in_flight_, so the hook does
+  static bool DiscardQueued(void* context, ThreadPool&) {
+    auto* task = static_cast<TaskBase*>(context);
+    auto keep_alive = std::move(task->in_flight_);
+    task->CompleteDiscarded();
+    return true;
+  }
+
+  // Discard hook of a ScheduleAfter timer; the task may meanwhile have been scheduled by its predecessors
+  static bool DiscardUnscheduled(void* context, ThreadPool& pool) {
+    auto* task = static_cast<TaskBase*>(context);
+    if (task->is_scheduled_.exchange(true, std::memory_order_acq_rel)) {
+      return false;
+    }
+    task->pool_ = &pool;
+    task->CompleteDiscarded();
+    return true;
+  }
+
+  ThreadPool::DiscardHook UnscheduledDiscardHook() {
+    return ThreadPool::DiscardHook{&TaskBase::DiscardUnscheduled, this};
+  }
+
+  // True when a CancelIfLate task got its worker after the deadline; the task is then failed instead of run
+  bool DropIfLate() {
+    if (deadline_policy_ != DeadlinePolicy::CancelIfLate || ThreadPool::Clock::now() <= deadline_) {
+      return false;
+    }
+    SetException(std::make_exception_ptr(DeadlineExceededException()));
+    pool_->CountDroppedDeadline();
+    return true;
+  }
+
+  struct Successors {
+    std::vector<std::shared_ptr<TaskBase>> unconditional;
+    std::vector<std::shared_ptr<TaskBase>> conditional;
+  };
+
+  // Marks successors as notified and hands the lists to the caller; later Then/Finally calls notify directly.
+  // Caller holds successors_mutex_.
+  Successors TakeSuccessorsLocked() {
+    successors_notified_ = true;
+    if (profile_) {
+      for (auto* list : {&successors_unconditional_, &successors_conditional_}) {
+        for (auto& next : *list) {
+          ProfileEdge(*next);
+        }
+      }
+    }
+    return Successors{std::exchange(successors_unconditional_, {}), std::exchange(successors_conditional_, {})};
+  }
+
+  void NotifyTaken(ThreadPool& pool, const Successors& successors) {
+    for (auto& next : successors.unconditional) {
+      next->OnPredecessorFinished(pool, nullptr);
+    }
+    for (auto& next : successors.conditional) {
+      next->OnPredecessorFinished(pool, exception_);
+    }
+  }
+
+  void ProfileStarted() {
+    if (profile_) {
+      profile_->started_ns.store(TaskProfileNode::Now(), std::memory_order_relaxed);
+    }
+  }
+
+  // Called before NotifyFinished, so a profiler reading after Wait sees the finish time
+  void ProfileFinished() {
+    if (profile_) {
+      profile_->finished_ns.store(TaskProfileNode::Now(), std::memory_order_relaxed);
+    }
+  }
+
+  // A task skipped because a predecessor failed is recorded as a zero-length run
+  void ProfileSkipped() {
+    if (profile_) {
+      int64_t now = TaskProfileNode::Now();
+      profile_->enqueued_ns.store(now, std::memory_order_relaxed);
+      profile_->started_ns.store(now, std::memory_order_relaxed);
+      profile_->finished_ns.store(now, std::memory_order_relaxed);
+    }
+  }
+
+  void ProfileEdge(TaskBase& next) {
+    if (profile_ && next.profile_) {
+      next.profile_->AddPredecessor(profile_->id);
+    }
+  }
+
   virtual void Execute(ThreadPool& pool) = 0;
   virtual void NotifySuccessors(ThreadPool& pool) = 0;
 
-  std::atomic<int> predecessor_count_{0};
-  std::atomic<bool> is_done_{false};
+  // Fan-in state: hammered by every finishing predecessor, kept off the line waiters poll
+  alignas(kCacheLineSize) std::atomic<int> predecessor_count_{0};
   std::atomic<bool> is_scheduled_{false};
+
+  // Completion state: polled by Wait/IsDone/awaiters, written once per task
+  alignas(kCacheLineSize) std::atomic<bool> is_done_{false};
   std::exception_ptr exception_ = nullptr;
-  mutable std::mutex exception_mutex_;
+
+  alignas(kCacheLineSize) mutable std::mutex exception_mutex_;
   mutable std::mutex wait_mutex_;
   mutable std::condition_variable wait_cv_;
-  std::vector<std::shared_ptr<Task<void>>> successors_unconditional_;
-  std::vector<std::shared_ptr<Task<void>>> successors_conditional_;
+
+  // Successor lists (and Task<T>'s forwarding slots) are guarded by successors_mutex_
+  std::mutex successors_mutex_;
+  bool successors_notified_ = false;
+  std::vector<std::shared_ptr<TaskBase>> successors_unconditional_;
+  std::vector<std::shared_ptr<TaskBase>> successors_conditional_;
+
+  // Owned by the queued job between Execute and the callback, so the job captures only a raw pointer and
+  // std::function stores it inline; a shared_ptr capture would cost a heap allocation per task run
+  ThreadPool* pool_ = nullptr;
+  std::shared_ptr<TaskBase> in_flight_;
+
+  ThreadPool::Clock::time_point deadline_ = ThreadPool::Clock::time_point::max();
+  DeadlinePolicy deadline_policy_ = DeadlinePolicy::RunLate;
+
+  std::shared_ptr<TaskProfileNode> profile_;  // set by TaskGraphProfiler::Track, null when not profiled
 
   template <typename U>
   friend class Task;
   template <typename U>
   friend struct TaskAwaiter;
+  friend class TaskGraphProfiler;
+  friend class Fiber;
+  friend class ThreadPool;
 };
 
 // Specialization for Task<void> must be defined first
@@ -90,18 +339,25 @@ class Task<void> : public TaskBase, public std::enable_shared_from_this<Task<voi
   explicit Task(std::function<void()> callback) : callback_(std::move(callback)) {
   }
 
-  std::shared_ptr<Task<void>> Finally(std::shared_ptr<Task<void>> next) {
-    successors_unconditional_.push_back(next);
-    next->predecessor_count_.fetch_add(1, std::memory_order_relaxed);
+  template <typename U>
+  std::shared_ptr<Task<U>> Finally(std::shared_ptr<Task<U>> next) {
+    AddSuccessor(successors_unconditional_, next, false);
     return next;
   }
 
-  std::shared_ptr<Task<void>> Then(std::shared_ptr<Task<void>> next) {
-    successors_conditional_.push_back(next);
-    next->predecessor_count_.fetch_add(1, std::memory_order_relaxed);
+  template <typename U>
+  std::shared_ptr<Task<U>> Then(std::shared_ptr<Task<U>> next) {
+    AddSuccessor(successors_conditional_, next, true);
     return next;
   }
 
+  // Runs fn once this task succeeded; returns the new stage
+  template <typename F>
+    requires std::invocable<F&>
+  std::shared_ptr<Task<std::invoke_result_t<F&>>> Then(F&& fn) {
+    return Then(std::make_shared<Task<std::invoke_result_t<F&>>>(std::forward<F>(fn)));
+  }
+
   Task(const Task&) = delete;
   Task& operator=(const Task&) = delete;
   Task(Task&&) = delete;
@@ -109,33 +365,38 @@ class Task<void> : public TaskBase, public std::enable_shared_from_this<Task<voi
 
  private:
   void Execute(ThreadPool& pool) override {
+    pool_ = &pool;
     if (exception_) {
+      ProfileSkipped();
       NotifyFinished();
       NotifySuccessors(pool);
       return;
     }
 
-    auto self = shared_from_this();
-    pool.Enqueue([self, &pool]() {
+    in_flight_ = shared_from_this();
+    EnqueueJob(pool, [task = this]() {
+      auto keep_alive = std::move(task->in_flight_);
+      task->ProfileStarted();
       try {
-        if (self->callback_) {
-          self->callback_();
+        if (task->callback_ && !task->DropIfLate()) {
+          task->callback_();
         }
       } catch (...) {
-        self->exception_ = std::current_exception();
+        task->SetException(std::current_exception());
       }
-      self->NotifyFinished();
-      self->NotifySuccessors(pool);
+      task->ProfileFinished();
+      task->NotifyFinished();
+      task->NotifySuccessors(*task->pool_);
     });
   }
 
   void NotifySuccessors(ThreadPool& pool) override {
-    for (auto& next : successors_unconditional_) {
-      next->OnPredecessorFinished(pool, nullptr);
-    }
-    for (auto& next : successors_conditional_) {
-      next->OnPredecessorFinished(pool, exception_);
+    Successors successors;
+    {
+      std::lock_guard<std::mutex> lock(successors_mutex_);
+      successors = TakeSuccessorsLocked();
     }
+    NotifyTaken(pool, successors);
   }
 
   std::function<void()> callback_;
@@ -148,35 +409,56 @@ class Task : public TaskBase, public std::enable_shared_from_this<Task<T>> {
   explicit Task(std::function<T()> callback) : callback_(std::move(callback)) {
   }
 
-  std::shared_ptr<Task<T>> Finally(std::shared_ptr<Task<T>> next) {
-    successors_t_unconditional_.push_back(next);
-    next->predecessor_count_.fetch_add(1, std::memory_order_relaxed);
+  template <typename U>
+  std::shared_ptr<Task<U>> Finally(std::shared_ptr<Task<U>> next) {
+    this->AddSuccessor(successors_unconditional_, next, false);
     return next;
   }
 
-  std::shared_ptr<Task<void>> Finally(std::shared_ptr<Task<void>> next) {
-    successors_unconditional_.push_back(next);
-    next->predecessor_count_.fetch_add(1, std::memory_order_relaxed);
+  template <typename U>
+  std::shared_ptr<Task<U>> Then(std::shared_ptr<Task<U>> next) {
+    this->AddSuccessor(successors_conditional_, next, true);
     return next;
   }
 
-  std::shared_ptr<Task<T>> Then(std::shared_ptr<Task<T>> next) {
-    successors_t_conditional_.push_back(next);
-    next->predecessor_count_.fetch_add(1, std::memory_order_relaxed);
-    return next;
+  // Runs fn on this task's result once it succeeded; the result is moved into fn, see the file notes
+  template <typename F>
+    requires std::invocable<F&, T&&>
+  std::shared_ptr<Task<std::invoke_result_t<F&, T&&>>> Then(F&& fn) {
+    auto stage = std::make_shared<StageTask<T, std::invoke_result_t<F&, T&&>>>(std::forward<F>(fn));
+    AddForwardingSuccessor(stage, stage->input_);
+    return stage;
   }
 
-  std::shared_ptr<Task<void>> Then(std::shared_ptr<Task<void>> next) {
-    successors_conditional_.push_back(next);
-    next->predecessor_count_.fetch_add(1, std::memory_order_relaxed);
-    return next;
+  // The result, read in place; rethrows the task's exception. Call after the task is done.
+  const T& Result() const {
+    CheckResult();
+    return *result_;
   }
 
-  T GetResult() {
-    if (exception_) {
-      std::rethrow_exception(exception_);
+  const T& GetResult() const {
+    return Result();
+  }
+
+  // Moves the result out; later Result/SharedResult/TakeResult calls throw. Refused once the result is shared.
+  // Safe to race SharedResult: exactly one of them wins. A reference from Result must not be in use meanwhile.
+  T TakeResult() {
+    std::lock_guard<std::mutex> lock(this->successors_mutex_);
+    CheckResult();
+    if (shared_) {
+      throw std::logic_error("Task result is shared and cannot be taken");
     }
-    return std::move(*result_);
+    T result = std::move(*result_);
+    result_.reset();
+    return result;
+  }
+
+  // Pointer to the result that keeps the task, and with it the one stored value, alive; no copy per reader
+  std::shared_ptr<const T> SharedResult() {
+    std::lock_guard<std::mutex> lock(this->successors_mutex_);
+    CheckResult();
+    shared_ = true;
+    return std::shared_ptr<const T>(this->shared_from_this(), &*result_);
   }
 
   Task(const Task&) = delete;
@@ -186,45 +468,122 @@ class Task : public TaskBase, public std::enable_shared_from_this<Task<T>> {
 
  private:
   void Execute(ThreadPool& pool) override {
+    this->pool_ = &pool;
     if (exception_) {  // return if exception for thenSuccess path
+      ProfileSkipped();
       NotifyFinished();
       NotifySuccessors(pool);
       return;
     }
 
-    auto self = this->shared_from_this();
-    pool.Enqueue([self, &pool]() {
+    this->in_flight_ = this->shared_from_this();
+    this->EnqueueJob(pool, [task = this]() {
+      auto keep_alive = std::move(task->in_flight_);
+      task->ProfileStarted();
       try {
-        if (self->callback_) {
-          self->result_ = self->callback_();
+        if (task->callback_ && !task->DropIfLate()) {
+          task->result_ = task->callback_();
         }
       } catch (...) {
-        self->exception_ = std::current_exception();
+        task->SetException(std::current_exception());
       }
-      self->NotifyFinished();
-      self->NotifySuccessors(pool);
+      task->ProfileFinished();
+
+      // Forwarded before done is published, so readers woken by Wait never race a stage moving the result away
+      Successors successors = task->TakeSuccessorsAndForward();
+      task->NotifyFinished();
+      task->NotifyTaken(*task->pool_, successors);
     });
   }
 
   void NotifySuccessors(ThreadPool& pool) override {
-    for (auto& next : successors_t_unconditional_) {
-      next->OnPredecessorFinished(pool, nullptr);
+    this->NotifyTaken(pool, TakeSuccessorsAndForward());
+  }
+
+  // Slots are taken together with the lists, so a stage attached meanwhile is served by AddForwardingSuccessor
+  Successors TakeSuccessorsAndForward() {
+    Successors successors;
+    std::vector<std::optional<T>*> slots;
+    {
+      std::lock_guard<std::mutex> lock(this->successors_mutex_);
+      successors = this->TakeSuccessorsLocked();
+      slots = std::exchange(forward_slots_, {});
     }
-    for (auto& next : successors_t_conditional_) {
-      next->OnPredecessorFinished(pool, exception_);
+    if (!exception_ && result_ && !slots.empty()) {
+      for (size_t i = 0; i + 1 < slots.size(); ++i) {
+        if constexpr (std::is_copy_constructible_v<T>) {
+          slots[i]->emplace(*result_);
+        }
+      }
+      slots.back()->emplace(std::move(*result_));
+      result_.reset();
     }
-    for (auto& next : successors_unconditional_) {
-      next->OnPredecessorFinished(pool, nullptr);
+    return successors;
+  }
+
+  void CheckResult() const {
+    if (exception_) {
+      std::rethrow_exception(exception_);
     }
-    for (auto& next : successors_conditional_) {
-      next->OnPredecessorFinished(pool, exception_);
+    if (!result_) {
+      throw std::logic_error(IsDone() ? "Task result was taken or moved into a Then stage" : "Task has not finished");
     }
   }
 
+  // Registers a Then(fn) stage whose input is slot; the result is delivered into slot before the stage is notified
+  void AddForwardingSuccessor(std::shared_ptr<TaskBase> stage, std::optional<T>& slot) {
+    {
+      std::lock_guard<std::mutex> lock(this->successors_mutex_);
+      if (!this->successors_notified_) {
+        if constexpr (!std::is_copy_constructible_v<T>) {
+          if (!forward_slots_.empty()) {
+            throw std::logic_error("A move-only Task result can be forwarded to one Then stage only");
+          }
+        }
+        stage->predecessor_count_.fetch_add(1, std::memory_order_relaxed);
+        successors_conditional_.push_back(std::move(stage));
+        forward_slots_.push_back(&slot);
+        return;
+      }
+    }
+
+    // Already finished: copy the result if it is still here (a move-only one is taken), otherwise fail the stage
+    std::exception_ptr exception = exception_;
+    if (!exception) {
+      try {
+        if constexpr (std::is_copy_constructible_v<T>) {
+          slot.emplace(Result());
+        } else {
+          slot.emplace(TakeResult());
+        }
+      } catch (...) {
+        exception = std::current_exception();
+      }
+    }
+    stage->predecessor_count_.fetch_add(1, std::memory_order_relaxed);
+    this->ProfileEdge(*stage);
+    stage->OnPredecessorFinished(*this->pool_, exception);
+  }
+
   std::function<T()> callback_;
   std::optional<T> result_;
-  std::vector<std::shared_ptr<Task<T>>> successors_t_unconditional_;
-  std::vector<std::shared_ptr<Task<T>>> successors_t_conditional_;
+  bool shared_ = false;  // set by SharedResult, TakeResult refuses from then on; both hold successors_mutex_
+  std::vector<std::optional<T>*> forward_slots_;  // inputs of Then(fn) stages, parallel to their successor entries
 
   friend class Task<void>;
 };
+
+// Task<Out> fed by its predecessor's result: Task<In>::NotifySuccessors fills input_ before notifying it
+template <typename In, typename Out>
+class StageTask : public Task<Out> {
+ public:
+  template <typename F>
+  explicit StageTask(F&& fn)
+      : Task<Out>([this, fn = std::forward<F>(fn)]() mutable -> Out { return std::invoke(fn, std::move(*input_)); }) {
+  }
+
+ private:
+  std::optional<In> input_;
+
+  friend class Task<In>;
+};
@@ -3,22 +3,32 @@
  * @brief Coroutine awaiter for Task<T> and Task<void>.
  * @details Provides awaitable adapters that resume coroutines when underlying tasks complete and handle exceptions/results.
  * @note Use within coroutines to await tasks; resume happens via a resumption Task
+ * @note WithToken(task, token, pool) also resumes, with TaskCancelledException, as soon as the token is cancelled
  *
  * @code{.cpp}
  * TaskAwaiter<void> awaiter{task, pool};
  * co_await awaiter;
+ *
+ * Mesh mesh = co_await WithToken(load, scope.GetToken(), pool);  // throws TaskCancelledException once scope dies
  * @endcode
  */
 
 #pragma once
 
+#include <atomic>
 #include <coroutine>
+#include <type_traits>
 
+#include "CancellationToken.hpp"
 #include "Task.hpp"
 
-// Primary template for TaskAwaiter<T> - returns the task's result
+// Primary template for TaskAwaiter<T> - a copyable result is returned as a const reference into the task, so any
+// number of coroutines can await the same task without copying it (the reference lives as long as the task); a
+// move-only result is moved out with TakeResult, so such a task can be awaited once
 template <typename T>
 struct TaskAwaiter {
+  using ResumeType = std::conditional_t<std::is_copy_constructible_v<T>, const T&, T>;
+
   std::shared_ptr<Task<T>> task;
   ThreadPool& pool;
 
@@ -27,25 +37,31 @@ struct TaskAwaiter {
   }
 
   void await_suspend(std::coroutine_handle<> awaiting_coro) {
+    // Only locals past this point: once the resumption is attached the coroutine may resume on a worker and
+    // destroy this awaiter, so the task is kept alive and the pool reached through copies
+    auto awaited = task;
+    ThreadPool& resume_pool = pool;
     auto resumption = std::make_shared<Task<void>>([awaiting_coro]() { awaiting_coro.resume(); });
 
-    task->Finally(resumption);
+    // Finally notifies the resumption itself if the task already finished, so it runs exactly once
+    awaited->Finally(resumption);
+    awaited->TrySchedule(resume_pool);
+  }
 
-    if (task->IsDone()) {
-      resumption->OnPredecessorFinished(pool);
+  ResumeType await_resume() {
+    if constexpr (std::is_copy_constructible_v<T>) {
+      return task->Result();
     } else {
-      task->TrySchedule(pool);
+      return task->TakeResult();
     }
   }
-
-  T await_resume() {
-    return task->GetResult();
-  }
 };
 
 // Specialization for TaskAwaiter<void> - maintains existing behavior
 template <>
 struct TaskAwaiter<void> {
+  using ResumeType = void;
+
   std::shared_ptr<Task<void>> task;
   ThreadPool& pool;
 
@@ -54,15 +70,15 @@ struct TaskAwaiter<void> {
   }
 
   void await_suspend(std::coroutine_handle<> awaiting_coro) {
+    // Only locals past this point: once the resumption is attached the coroutine may resume on a worker and
+    // destroy this awaiter, so the task is kept alive and the pool reached through copies
+    auto awaited = task;
+    ThreadPool& resume_pool = pool;
     auto resumption = std::make_shared<Task<void>>([awaiting_coro]() { awaiting_coro.resume(); });
 
-    task->Finally(resumption);
-
-    if (task->IsDone()) {
-      resumption->OnPredecessorFinished(pool);
-    } else {
-      task->TrySchedule(pool);
-    }
+    // Finally notifies the resumption itself if the task already finished, so it runs exactly once
+    awaited->Finally(resumption);
+    awaited->TrySchedule(resume_pool);
   }
 
   void await_resume() {
@@ -71,3 +87,86 @@ struct TaskAwaiter<void> {
     }
   }
 };
+
+namespace detail {
+
+// Shared by the two ways a CancellableTaskAwaiter can resume; whichever claims it first resumes the coroutine
+struct CancellableAwaitState {
+  explicit CancellableAwaitState(std::coroutine_handle<> awaiting_coro) : coro(awaiting_coro) {
+  }
+
+  bool TryClaim() {
+    return !claimed.exchange(true, std::memory_order_acq_rel);
+  }
+
+  std::coroutine_handle<> coro;
+  std::atomic<bool> claimed{false};
+  bool cancelled = false;  // set by the cancellation path before it resumes the coroutine
+  CancellationToken::CallbackId callback_id = CancellationToken::kNoCallback;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Awaits task like TaskAwaiter, but stops waiting once token is cancelled
+ * @details On cancellation the coroutine is resumed on the pool (never on the thread calling Cancel) and co_await
+ *          throws TaskCancelledException; the task itself is not cancelled. On normal completion the token callback is
+ *          unregistered, so a long-lived token does not collect one entry per finished await.
+ * @note A null token makes this a plain TaskAwaiter
+ */
+template <typename T>
+struct CancellableTaskAwaiter {
+  std::shared_ptr<Task<T>> task;
+  CancellationTokenPtr token;
+  ThreadPool& pool;
+  std::shared_ptr<detail::CancellableAwaitState> state;  // set while suspended
+
+  bool await_ready() {
+    return task->IsDone() || (token && token->IsCancelled());
+  }
+
+  void await_suspend(std::coroutine_handle<> awaiting_coro) {
+    // Only locals past this point: once a path can resume the coroutine, this awaiter may already be destroyed
+    auto shared_state = std::make_shared<detail::CancellableAwaitState>(awaiting_coro);
+    state = shared_state;
+    auto awaited = task;
+    ThreadPool& resume_pool = pool;
+
+    // Registered before the completion path exists, so callback_id is set before a normal resume can read it
+    if (token) {
+      shared_state->callback_id = token->RegisterCallback([shared_state, &resume_pool]() {
+        if (shared_state->TryClaim()) {
+          shared_state->cancelled = true;
+          resume_pool.Enqueue([coro = shared_state->coro]() { coro.resume(); });
+        }
+      });
+    }
+
+    auto resumption = std::make_shared<Task<void>>([shared_state]() {
+      if (shared_state->TryClaim()) {
+        shared_state->coro.resume();
+      }
+    });
+    awaited->Finally(resumption);
+    awaited->TrySchedule(resume_pool);
+  }
+
+  typename TaskAwaiter<T>::ResumeType await_resume() {
+    if (state) {
+      if (state->cancelled) {
+        throw TaskCancelledException();
+      }
+      if (token) {
+        token->UnregisterCallback(state->callback_id);
+      }
+    } else if (!task->IsDone()) {
+      throw TaskCancelledException();  // ready without suspending because the token was already cancelled
+    }
+    return TaskAwaiter<T>{task, pool}.await_resume();
+  }
+};
+
+template <typename T>
+CancellableTaskAwaiter<T> WithToken(std::shared_ptr<Task<T>> task, CancellationTokenPtr token, ThreadPool& pool) {
+  return CancellableTaskAwaiter<T>{std::move(task), std::move(token), pool, nullptr};
+}
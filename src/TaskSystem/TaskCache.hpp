@@ -0,0 +1,214 @@
+/**
+ * @file TaskCache.hpp
+ * @brief Keyed memoization of Task<T> results with in-flight sharing and a byte-budgeted LRU.
+ * @details Concurrent requests for the same key share one in-flight Task<T>. Completed results are kept in an
+ *          LRU bounded by a byte budget and served to later requests without re-running the factory.
+ *          Evictions are reported through an optional callback and counted in Stats.
+ * @note Failed factories are not cached; the next request for that key runs the factory again
+ *
+ * @code{.cpp}
+ * TaskCache<std::string, ShaderBlob> cache(pool, 64 * 1024 * 1024, [](const ShaderBlob& b) { return b.bytes.size(); });
+ * auto task = cache.GetOrCreate("lit.vs", [] { return CompileShader("lit.vs"); });
+ * co_await TaskAwaiter<ShaderBlob>{task, pool};
+ * @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Task.hpp"
+#include "ThreadPool.hpp"
+
+template <typename K, typename T, typename Hash = std::hash<K>>
+class TaskCache {
+ public:
+  using SizeFunction = std::function<size_t(const T&)>;
+  using EvictionCallback = std::function<void(const K&, size_t bytes)>;
+
+  struct Stats {
+    size_t hits = 0;       // served from the LRU
+    size_t joins = 0;      // attached to an in-flight task
+    size_t misses = 0;     // ran the factory
+    size_t evictions = 0;  // dropped from the LRU to honour the byte budget
+    size_t entries = 0;
+    size_t bytes = 0;
+  };
+
+  TaskCache(ThreadPool& pool, size_t byte_budget, SizeFunction size_of = [](const T&) { return sizeof(T); })
+      : pool_(pool), state_(std::make_shared<State>(byte_budget, std::move(size_of))) {
+  }
+
+  /**
+   * @brief Returns a scheduled task producing the value for key, running factory only on a miss.
+   */
+  std::shared_ptr<Task<T>> GetOrCreate(const K& key, std::function<T()> factory) {
+    std::shared_ptr<const T> cached;
+    std::shared_ptr<Task<T>> task;
+
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      auto lru_it = state_->index.find(key);
+      if (lru_it != state_->index.end()) {
+        state_->lru.splice(state_->lru.begin(), state_->lru, lru_it->second);  // mark as most recently used
+        cached = lru_it->second->value;
+        state_->stats.hits++;
+      } else {
+        auto flight_it = state_->in_flight.find(key);
+        if (flight_it != state_->in_flight.end()) {
+          state_->stats.joins++;
+          return flight_it->second;
+        }
+
+        std::weak_ptr<State> weak_state = state_;
+        task = std::make_shared<Task<T>>([weak_state, key, factory = std::move(factory)]() -> T {
+          try {
+            T value = factory();
+            if (auto state = weak_state.lock()) {
+              state->Complete(key, value);
+            }
+            return value;
+          } catch (...) {
+            if (auto state = weak_state.lock()) {
+              state->Abandon(key);
+            }
+            throw;
+          }
+        });
+        state_->in_flight.emplace(key, task);
+        state_->stats.misses++;
+      }
+    }
+
+    if (cached) {
+      task = std::make_shared<Task<T>>([cached]() -> T { return *cached; });
+    }
+    task->TrySchedule(pool_);
+    return task;
+  }
+
+  /**
+   * @brief Returns the cached value without scheduling anything, or nullptr when the key is not resident.
+   */
+  std::shared_ptr<const T> Peek(const K& key) const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    auto it = state_->index.find(key);
+    return it != state_->index.end() ? it->second->value : nullptr;
+  }
+
+  // Drops a completed entry; an in-flight task for the key still completes and repopulates the cache
+  void Invalidate(const K& key) {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    auto it = state_->index.find(key);
+    if (it != state_->index.end()) {
+      state_->bytes -= it->second->bytes;
+      state_->lru.erase(it->second);
+      state_->index.erase(it);
+    }
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->lru.clear();
+    state_->index.clear();
+    state_->bytes = 0;
+  }
+
+  void SetEvictionCallback(EvictionCallback callback) {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->on_evict = std::move(callback);
+  }
+
+  Stats GetStats() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    Stats stats = state_->stats;
+    stats.entries = state_->lru.size();
+    stats.bytes = state_->bytes;
+    return stats;
+  }
+
+  TaskCache(const TaskCache&) = delete;
+  TaskCache& operator=(const TaskCache&) = delete;
+  TaskCache(TaskCache&&) = delete;
+  TaskCache& operator=(TaskCache&&) = delete;
+
+ private:
+  struct Entry {
+    K key;
+    std::shared_ptr<const T> value;
+    size_t bytes;
+  };
+
+  // Shared with in-flight task callbacks so a task finishing after the cache is gone stays safe
+  struct State {
+    State(size_t budget, SizeFunction size_fn) : byte_budget(budget), size_of(std::move(size_fn)) {
+    }
+
+    void Complete(const K& key, const T& value) {
+      size_t entry_bytes = size_of(value);
+      std::vector<Entry> evicted;
+      EvictionCallback callback;
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        in_flight.erase(key);
+
+        auto existing = index.find(key);
+        if (existing != index.end()) {
+          bytes -= existing->second->bytes;
+          lru.erase(existing->second);
+          index.erase(existing);
+        }
+
+        lru.push_front(Entry{key, std::make_shared<const T>(value), entry_bytes});
+        index.emplace(key, lru.begin());
+        bytes += entry_bytes;
+
+        while (bytes > byte_budget && !lru.empty()) {
+          Entry& victim = lru.back();
+          bytes -= victim.bytes;
+          index.erase(victim.key);
+          evicted.push_back(std::move(victim));
+          lru.pop_back();
+          stats.evictions++;
+        }
+
+        if (!evicted.empty()) {
+          callback = on_evict;
+        }
+      }
+
+      // Report outside the lock so the callback may call back into the cache
+      if (callback) {
+        for (const auto& entry : evicted) {
+          callback(entry.key, entry.bytes);
+        }
+      }
+    }
+
+    void Abandon(const K& key) {
+      std::lock_guard<std::mutex> lock(mutex);
+      in_flight.erase(key);
+    }
+
+    mutable std::mutex mutex;
+    size_t byte_budget;
+    size_t bytes = 0;
+    SizeFunction size_of;
+    EvictionCallback on_evict;
+    std::list<Entry> lru;  // front = most recently used
+    std::unordered_map<K, typename std::list<Entry>::iterator, Hash> index;
+    std::unordered_map<K, std::shared_ptr<Task<T>>, Hash> in_flight;
+    Stats stats;
+  };
+
+  ThreadPool& pool_;
+  std::shared_ptr<State> state_;
+};
@@ -2,18 +2,22 @@
  * @file TaskExtensions.hpp
  * @brief Extension helpers: cancellation, timeout, polling variants, and task composition.
  * @details Provides WithCancellation, WithTimeout, WithPollingCancellation helpers to adapt work into cancellable tasks,
- *          and WhenAll for aggregating multiple tasks.
+ *          WhenAll for aggregating multiple tasks, and FuseStages for running a linear chain of stages as one task.
  * @note WithTimeout returns an out CancellationTokenPtr if requested
  *
  * @code{.cpp}
  * auto t = WithCancellation([]() { return 1; }, MakeCancellationToken());
  * auto aggregated = WhenAll(pool, {task1, task2, task3});
+ * auto frame = FuseStages([]() { return Load(); }, [](Mesh mesh) { return Cull(std::move(mesh)); });
  * @endcode
  */
 #pragma once
 
 #include <chrono>
+#include <functional>
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "CancellationToken.hpp"
@@ -104,6 +108,10 @@ inline std::shared_ptr<Task<void>> WhenAll(ThreadPool& pool, std::vector<std::sh
 inline std::shared_ptr<Task<void>> WhenAllWithCancellation(
   ThreadPool& pool, std::vector<std::shared_ptr<Task<void>>> tasks, CancellationTokenPtr token) {
   if (token && token->IsCancelled()) {
+    // Children are still scheduled so callers waiting on them are released; cancellable ones throw right away
+    for (auto& task : tasks) {
+      task->TrySchedule(pool);
+    }
     auto cancelled_task = std::make_shared<Task<void>>([]() { throw TaskCancelledException(); });
     cancelled_task->TrySchedule(pool);
     return cancelled_task;
@@ -131,3 +139,37 @@ inline std::shared_ptr<Task<void>> WhenAllWithCancellation(
 
   return aggregate_task;
 }
+
+namespace detail {
+
+template <typename F>
+auto ComposeStages(F&& first) {
+  return std::forward<F>(first);
+}
+
+// Folds the stages left to right into one callable; a stage returning void is followed by one taking no argument
+template <typename F, typename G, typename... Rest>
+auto ComposeStages(F&& first, G&& second, Rest&&... rest) {
+  auto composed = [first = std::forward<F>(first), second = std::forward<G>(second)]() mutable -> decltype(auto) {
+    if constexpr (std::is_void_v<std::invoke_result_t<F&>>) {
+      first();
+      return std::invoke(second);
+    } else {
+      return std::invoke(second, first());
+    }
+  };
+  return ComposeStages(std::move(composed), std::forward<Rest>(rest)...);
+}
+
+}  // namespace detail
+
+// One task that runs the stages in order, each result moved straight into the next stage. Use it instead of a
+// Then(fn) chain when the stages are known up front: one task, one queue hop, no intermediate results stored.
+// A failing stage fails the task; the stages after it do not run.
+template <typename... Stages>
+auto FuseStages(Stages&&... stages) {
+  static_assert(sizeof...(Stages) > 0, "FuseStages needs at least one stage");
+  auto fused = detail::ComposeStages(std::forward<Stages>(stages)...);
+  using Result = std::invoke_result_t<decltype(fused)&>;
+  return std::make_shared<Task<Result>>(std::move(fused));
+}
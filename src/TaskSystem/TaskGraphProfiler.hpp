@@ -0,0 +1,226 @@
+/**
+ * @file TaskGraphProfiler.hpp
+ * @brief Opt-in profiler for task graphs: per-node timings, critical path, parallelism, DOT/JSON export.
+ * @details Tracked tasks record when they became ready (enqueue), started and finished, and which tracked
+ *          predecessors released them. Analyze walks back from the node that finished last, always through the
+ *          predecessor that finished last, which yields the chain of edges that set the graph's wall time.
+ *          Parallelism is total run time over wall time.
+ * @note Track tasks before they can run; edges from untracked tasks are not recorded
+ * @note Analyze and the exporters are meant to be called once the tracked tasks have finished
+ *
+ * @code{.cpp}
+ * TaskGraphProfiler profiler;
+ * profiler.Track(physics, "physics");
+ * profiler.Track(render, "render");
+ * physics->Then(render);
+ * physics->TrySchedule(pool);
+ * render->Wait();
+ * std::cout << profiler.ToDot();
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Task.hpp"
+
+class TaskGraphProfiler {
+ public:
+  struct NodeReport {
+    uint32_t id = 0;
+    std::string name;
+    double enqueue_ms = 0.0;  // relative to the earliest enqueue in the graph
+    double start_ms = 0.0;
+    double finish_ms = 0.0;
+    std::vector<uint32_t> predecessors;
+    bool critical = false;
+    bool finished = false;  // false for nodes that had not run when the report was taken
+
+    double RunMs() const {
+      return finish_ms - start_ms;
+    }
+
+    double QueueMs() const {
+      return start_ms - enqueue_ms;
+    }
+  };
+
+  struct Report {
+    std::vector<NodeReport> nodes;         // indexed by node id
+    std::vector<uint32_t> critical_path;   // from the first node to the one that finished last
+    double wall_ms = 0.0;                  // first enqueue to last finish
+    double critical_run_ms = 0.0;          // run time summed along the critical path
+    double total_run_ms = 0.0;
+    double parallelism = 0.0;              // total_run_ms / wall_ms
+  };
+
+  // Starts recording task under name; returns its node id
+  uint32_t Track(const std::shared_ptr<TaskBase>& task, std::string name) {
+    auto node = std::make_shared<TaskProfileNode>();
+    node->name = std::move(name);
+
+    std::lock_guard<std::mutex> lock(nodes_mutex_);
+    node->id = static_cast<uint32_t>(nodes_.size());
+    task->profile_ = node;
+    nodes_.push_back(std::move(node));
+    return nodes_.back()->id;
+  }
+
+  Report Analyze() const {
+    std::lock_guard<std::mutex> lock(nodes_mutex_);
+    Report report;
+    report.nodes.resize(nodes_.size());
+
+    int64_t origin = std::numeric_limits<int64_t>::max();
+    for (const auto& node : nodes_) {
+      if (node->finished_ns.load(std::memory_order_relaxed) != 0) {
+        origin = std::min(origin, node->enqueued_ns.load(std::memory_order_relaxed));
+      }
+    }
+
+    auto to_ms = [origin](int64_t ns) { return static_cast<double>(ns - origin) / 1e6; };
+    int64_t last_finish = std::numeric_limits<int64_t>::min();
+    uint32_t last_node = 0;
+    for (const auto& node : nodes_) {
+      NodeReport& out = report.nodes[node->id];
+      out.id = node->id;
+      out.name = node->name;
+      {
+        std::lock_guard<std::mutex> edges_lock(node->predecessors_mutex);
+        out.predecessors = node->predecessors;
+      }
+
+      int64_t finished = node->finished_ns.load(std::memory_order_relaxed);
+      if (finished == 0) {
+        continue;
+      }
+      out.finished = true;
+      out.enqueue_ms = to_ms(node->enqueued_ns.load(std::memory_order_relaxed));
+      out.start_ms = to_ms(node->started_ns.load(std::memory_order_relaxed));
+      out.finish_ms = to_ms(finished);
+      report.total_run_ms += out.RunMs();
+      if (finished > last_finish) {
+        last_finish = finished;
+        last_node = node->id;
+      }
+    }
+
+    if (last_finish == std::numeric_limits<int64_t>::min()) {
+      return report;  // nothing ran yet
+    }
+    report.wall_ms = to_ms(last_finish);
+    report.parallelism = report.wall_ms > 0.0 ? report.total_run_ms / report.wall_ms : 0.0;
+
+    // Walk back through the predecessor that released each node (the one that finished last)
+    for (uint32_t current = last_node;;) {
+      NodeReport& node = report.nodes[current];
+      node.critical = true;
+      report.critical_path.push_back(current);
+      report.critical_run_ms += node.RunMs();
+
+      const NodeReport* releaser = nullptr;
+      for (uint32_t predecessor : node.predecessors) {
+        const NodeReport& candidate = report.nodes[predecessor];
+        if (candidate.finished && !candidate.critical && (!releaser || candidate.finish_ms > releaser->finish_ms)) {
+          releaser = &candidate;
+        }
+      }
+      if (!releaser) {
+        break;
+      }
+      current = releaser->id;
+    }
+    std::reverse(report.critical_path.begin(), report.critical_path.end());
+    return report;
+  }
+
+  // Graphviz digraph; critical nodes and edges are drawn in red, labels carry run and queue times
+  std::string ToDot() const {
+    Report report = Analyze();
+    std::string out = "digraph TaskGraph {\n  rankdir=LR;\n  node [shape=box, fontname=\"monospace\"];\n";
+    char buffer[128];
+    for (const NodeReport& node : report.nodes) {
+      std::snprintf(buffer, sizeof(buffer), "\\nrun %.3f ms, queued %.3f ms", node.RunMs(), node.QueueMs());
+      out += "  n" + std::to_string(node.id) + " [label=\"" + Escape(node.name) + (node.finished ? buffer : "\\nnot run") + "\"";
+      out += node.critical ? ", color=red, penwidth=2];\n" : "];\n";
+    }
+    for (const NodeReport& node : report.nodes) {
+      for (uint32_t predecessor : node.predecessors) {
+        out += "  n" + std::to_string(predecessor) + " -> n" + std::to_string(node.id);
+        out += IsCriticalEdge(report, predecessor, node.id) ? " [color=red, penwidth=2];\n" : ";\n";
+      }
+    }
+    std::snprintf(buffer, sizeof(buffer), "wall %.3f ms, critical run %.3f ms, parallelism %.2f", report.wall_ms,
+                  report.critical_run_ms, report.parallelism);
+    out += "  label=\"" + std::string(buffer) + "\";\n}\n";
+    return out;
+  }
+
+  std::string ToJson() const {
+    Report report = Analyze();
+    char buffer[160];
+    std::snprintf(buffer, sizeof(buffer), "{\"wall_ms\":%.6f,\"critical_run_ms\":%.6f,\"total_run_ms\":%.6f,\"parallelism\":%.6f,",
+                  report.wall_ms, report.critical_run_ms, report.total_run_ms, report.parallelism);
+    std::string out = buffer;
+
+    out += "\"critical_path\":[";
+    for (size_t i = 0; i < report.critical_path.size(); ++i) {
+      out += (i ? "," : "") + std::to_string(report.critical_path[i]);
+    }
+    out += "],\"nodes\":[";
+    for (size_t i = 0; i < report.nodes.size(); ++i) {
+      const NodeReport& node = report.nodes[i];
+      std::snprintf(buffer, sizeof(buffer), "\"enqueue_ms\":%.6f,\"start_ms\":%.6f,\"finish_ms\":%.6f,", node.enqueue_ms,
+                    node.start_ms, node.finish_ms);
+      out += (i ? ",{" : "{") + std::string("\"id\":") + std::to_string(node.id) + ",\"name\":\"" + Escape(node.name) + "\",";
+      out += buffer;
+      out += std::string("\"finished\":") + (node.finished ? "true" : "false") + ",\"critical\":" + (node.critical ? "true" : "false");
+      out += ",\"predecessors\":[";
+      for (size_t p = 0; p < node.predecessors.size(); ++p) {
+        out += (p ? "," : "") + std::to_string(node.predecessors[p]);
+      }
+      out += "]}";
+    }
+    out += "]}\n";
+    return out;
+  }
+
+ private:
+  // Escapes for both DOT and JSON string literals
+  static std::string Escape(std::string_view text) {
+    std::string out;
+    out.reserve(text.size());
+    for (char c : text) {
+      if (c == '"' || c == '\\') {
+        out += '\\';
+        out += c;
+      } else if (c == '\n') {
+        out += "\\n";
+      } else if (static_cast<unsigned char>(c) >= 0x20) {
+        out += c;
+      }
+    }
+    return out;
+  }
+
+  static bool IsCriticalEdge(const Report& report, uint32_t from, uint32_t to) {
+    for (size_t i = 1; i < report.critical_path.size(); ++i) {
+      if (report.critical_path[i - 1] == from && report.critical_path[i] == to) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  mutable std::mutex nodes_mutex_;
+  std::vector<std::shared_ptr<TaskProfileNode>> nodes_;
+};
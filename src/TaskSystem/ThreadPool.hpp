@@ -1,66 +1,292 @@
 /**
  * @file ThreadPool.hpp
  * @brief Simple fixed-size thread pool for enqueuing work.
- * @details Creates worker threads that process tasks from an internal queue and supports graceful shutdown in destructor.
+ * @details Creates worker threads that process tasks from an internal queue. Shutdown stops the pool in one of three
+ *          modes (drain everything, discard pending work, or drain until a timeout and discard the rest) and reports how
+ *          much work was run and dropped; the destructor drains if Shutdown was not called.
+ *          Work with a due time goes through EnqueueWithDeadline into an earliest-deadline-first lane that workers
+ *          drain before the FIFO queue; how many deadline jobs finished in time is reported by GetDeadlineMetrics.
+ *          Delayed and periodic work (EnqueueAt/After, ScheduleAt/After, ScheduleEvery) waits in a timer heap served by one
+ *          timer thread, started on first use, which moves due entries onto the FIFO queue; no worker sleeps.
  * @note Default thread count is `hardware_concurrency() - 1` (at least one)
+ * @note The deadline lane has strict priority, so a steady stream of deadline work can starve plain Enqueue work
+ * @note Timers still pending at shutdown are discarded in every mode
+ * @note Discarded jobs never run; jobs enqueued with a DiscardHook (every Task job) get the hook called instead, so a
+ *       discarded Task completes with TaskDiscardedException and its waiters wake up
  *
  * @code{.cpp}
  * ThreadPool pool(4);
  * pool.Enqueue([](){});
+ * pool.EnqueueWithDeadline(ThreadPool::Clock::now() + std::chrono::milliseconds(16), [](){});
+ * pool.ScheduleAfter(std::chrono::milliseconds(50), task);
+ * pool.ScheduleEvery(std::chrono::seconds(1), [](){ Autosave(); }, token);
+ * auto report = pool.Shutdown(ThreadPool::ShutdownMode::Deadline, std::chrono::seconds(2));
  * @endcode
  */
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
 #include <vector>
 
+#include "CacheLine.hpp"
+#include "CancellationToken.hpp"
+
+template <typename T>
+class Task;
+
 class ThreadPool {
  public:
+  using Clock = std::chrono::steady_clock;
+
+  // Deadline jobs finished by (met) or after (missed) their deadline; dropped counts the missed ones whose work was
+  // skipped, see TaskBase::SetDeadline
+  struct DeadlineMetrics {
+    uint64_t met = 0;
+    uint64_t missed = 0;
+    uint64_t dropped = 0;
+  };
+
+  enum class ShutdownMode {
+    Drain,           // run all queued work, including work it enqueues
+    DiscardPending,  // let running jobs finish, discard everything still queued
+    Deadline,        // drain until the timeout, then discard what is left
+  };
+
+  struct ShutdownReport {
+    uint64_t executed = 0;         // jobs run after Shutdown was called
+    uint64_t discarded = 0;        // jobs dropped unrun, from the FIFO queue and the deadline lane
+    uint64_t tasksCancelled = 0;   // discarded jobs and timers whose DiscardHook completed them as cancelled
+    uint64_t timersDiscarded = 0;  // delayed and periodic entries still pending
+    bool timedOut = false;         // Deadline mode only: the timeout expired before the queue drained
+    Clock::duration elapsed{};
+  };
+
+  // Called instead of a job that a shutdown discards; returns whether it completed something as cancelled.
+  // A plain function pointer so enqueuing stays allocation-free; {} means no hook.
+  struct DiscardHook {
+    bool (*fn)(void* context, ThreadPool& pool);
+    void* context;
+  };
+
   explicit ThreadPool(size_t threads = GetDefaultThreadCount()) {
     for (size_t i = 0; i < threads; ++i) {
+      ++liveWorkers;
       workers.emplace_back(std::thread([this] {
         while (true) {
           std::function<void()> task;
+          DiscardHook onDiscard{};
+          Clock::time_point deadline = kNoDeadline;
+          bool stopping = false;
+          bool discard = false;
           {
             std::unique_lock<std::mutex> lock(queueMutex);
-            condition.wait(lock, [this] { return stop || !tasks.empty(); });
+            condition.wait(lock, [this] { return stop || !tasks.empty() || !deadlineTasks.empty(); });
 
             // Handling thread pool shutdown
-            if (stop && tasks.empty()) {
+            if (stop && tasks.empty() && deadlineTasks.empty()) {
+              // The last worker closes the queue before releasing the lock; a job pushed after it left would never run
+              if (--liveWorkers == 0) {
+                shutDown = true;
+              }
+              drainedCondition.notify_all();
               return;
             }
 
-            task = std::move(tasks.front());
-            tasks.pop();
+            if (!deadlineTasks.empty()) {
+              std::pop_heap(deadlineTasks.begin(), deadlineTasks.end(), LaterTime{});
+              task = std::move(deadlineTasks.back().task);
+              onDiscard = deadlineTasks.back().onDiscard;
+              deadline = deadlineTasks.back().time;
+              deadlineTasks.pop_back();
+            } else {
+              task = std::move(tasks.front().task);
+              onDiscard = tasks.front().onDiscard;
+              tasks.pop();
+            }
+            stopping = stop;
+            discard = discarding;
+          }
+
+          if (discard) {
+            Discard(std::move(task), onDiscard);
+            continue;
           }
           task();
+
+          if (deadline != kNoDeadline) {
+            (Clock::now() <= deadline ? deadlinesMet : deadlinesMissed).fetch_add(1, std::memory_order_relaxed);
+          }
+          if (stopping) {
+            shutdownExecuted.fetch_add(1, std::memory_order_relaxed);
+          }
         }
       }));
     }
   }
 
-  void Enqueue(std::function<void()> task) {
+  // onDiscard, if set, is called instead of task when a shutdown discards it (work enqueued after shutdown is discarded)
+  void Enqueue(std::function<void()> task, DiscardHook onDiscard = {}) {
     {
       std::unique_lock<std::mutex> lock(queueMutex);
-      tasks.emplace(std::move(task));
+      if (!shutDown) {
+        tasks.push(Job{std::move(task), onDiscard});
+        lock.unlock();
+        condition.notify_one();
+        return;
+      }
     }
-    condition.notify_one();
+    Discard(std::move(task), onDiscard);
   }
 
-  ~ThreadPool() {
+  // Runs task before any FIFO work, ordered by deadline (ties in submission order)
+  void EnqueueWithDeadline(Clock::time_point deadline, std::function<void()> task, DiscardHook onDiscard = {}) {
+    {
+      std::unique_lock<std::mutex> lock(queueMutex);
+      if (!shutDown) {
+        deadlineTasks.push_back(TimedTask{deadline, deadlineSequence++, std::move(task), onDiscard});
+        std::push_heap(deadlineTasks.begin(), deadlineTasks.end(), LaterTime{});
+        lock.unlock();
+        condition.notify_one();
+        return;
+      }
+    }
+    Discard(std::move(task), onDiscard);
+  }
+
+  // Enqueues task once due has passed (entries due at the same time keep submission order)
+  void EnqueueAt(Clock::time_point due, std::function<void()> task, DiscardHook onDiscard = {}) {
+    {
+      std::unique_lock<std::mutex> lock(timerMutex);
+      if (!timerStop) {
+        if (!timerThread.joinable()) {
+          timerThread = std::thread([this] { RunTimer(); });
+        }
+        timerTasks.push_back(TimedTask{due, timerSequence++, std::move(task), onDiscard});
+        std::push_heap(timerTasks.begin(), timerTasks.end(), LaterTime{});
+        lock.unlock();
+        timerCondition.notify_one();
+        return;
+      }
+    }
+    Discard(std::move(task), onDiscard);
+  }
+
+  void EnqueueAfter(Clock::duration delay, std::function<void()> task, DiscardHook onDiscard = {}) {
+    EnqueueAt(Clock::now() + delay, std::move(task), onDiscard);
+  }
+
+  // Schedules task once due has passed; it still waits for its predecessors, if any.
+  // If the pool shuts down first, the task completes as cancelled.
+  template <typename T>
+  void ScheduleAt(Clock::time_point due, std::shared_ptr<Task<T>> task) {
+    DiscardHook onDiscard = task->UnscheduledDiscardHook();
+    EnqueueAt(due, [this, task = std::move(task)]() { task->TrySchedule(*this); }, onDiscard);
+  }
+
+  template <typename T>
+  void ScheduleAfter(Clock::duration delay, std::shared_ptr<Task<T>> task) {
+    ScheduleAt(Clock::now() + delay, std::move(task));
+  }
+
+  // Runs fn on the pool every period until token is cancelled (a null token runs until the pool is destroyed).
+  // Fixed rate: ticks are period apart from the first one, and ticks missed while fn overran are skipped.
+  // Exceptions thrown by fn are swallowed and the timer keeps ticking.
+  void ScheduleEvery(Clock::duration period, std::function<void()> fn, CancellationTokenPtr token) {
+    auto timer = std::make_shared<PeriodicTimer>(PeriodicTimer{period, Clock::now() + period, std::move(fn), std::move(token)});
+    ArmPeriodic(std::move(timer));
+  }
+
+  // Called by deadline work that skipped itself because it started too late
+  void CountDroppedDeadline() {
+    deadlinesDropped.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  DeadlineMetrics GetDeadlineMetrics() const {
+    return DeadlineMetrics{.met = deadlinesMet.load(std::memory_order_relaxed),
+                           .missed = deadlinesMissed.load(std::memory_order_relaxed),
+                           .dropped = deadlinesDropped.load(std::memory_order_relaxed)};
+  }
+
+  size_t GetThreadCount() const {
+    return workers.size();
+  }
+
+  // Stops the pool and joins its workers; timeout is only used by ShutdownMode::Deadline. Jobs already running are
+  // never interrupted, so the call can outlast the timeout by the longest of them. Only the first call does anything.
+  // Must not be called from a pool worker.
+  ShutdownReport Shutdown(ShutdownMode mode = ShutdownMode::Drain, Clock::duration timeout = Clock::duration::zero()) {
+    ShutdownReport report;
+    auto start = Clock::now();
+
+    std::vector<TimedTask> pendingTimers;
+    {
+      std::lock_guard<std::mutex> lock(timerMutex);
+      if (timerStop) {
+        return report;
+      }
+      timerStop = true;
+    }
+    timerCondition.notify_all();
+    if (timerThread.joinable()) {
+      timerThread.join();
+    }
+    {
+      std::lock_guard<std::mutex> lock(timerMutex);
+      pendingTimers = std::move(timerTasks);
+    }
+    report.timersDiscarded = pendingTimers.size();
+    for (TimedTask& timer : pendingTimers) {
+      // May enqueue Finally successors of the cancelled task; they are handled per mode below
+      if (timer.onDiscard.fn && timer.onDiscard.fn(timer.onDiscard.context, *this)) {
+        report.tasksCancelled++;
+      }
+    }
+    pendingTimers.clear();
+
     {
       std::unique_lock<std::mutex> lock(queueMutex);
       stop = true;
+      discarding = mode == ShutdownMode::DiscardPending;
+      condition.notify_all();
+
+      if (mode == ShutdownMode::Deadline) {
+        auto deadline = timeout < Clock::time_point::max() - start ? start + timeout : Clock::time_point::max();
+        bool drained = drainedCondition.wait_until(lock, deadline, [this] { return liveWorkers == 0; });
+        if (!drained) {
+          report.timedOut = true;
+          discarding = true;
+          condition.notify_all();
+        }
+      }
     }
-    condition.notify_all();
     for (std::thread& worker : workers) {
       worker.join();
     }
+    {
+      std::lock_guard<std::mutex> lock(queueMutex);
+      shutDown = true;
+    }
+
+    report.executed = shutdownExecuted.load(std::memory_order_relaxed);
+    report.discarded = shutdownDiscarded.load(std::memory_order_relaxed);
+    report.tasksCancelled += shutdownCancelled.load(std::memory_order_relaxed);
+    report.elapsed = Clock::now() - start;
+    return report;
+  }
+
+  ~ThreadPool() {
+    Shutdown(ShutdownMode::Drain);
   }
 
   ThreadPool(const ThreadPool&) = delete;
@@ -69,6 +295,92 @@ class ThreadPool {
   ThreadPool& operator=(ThreadPool&&) = delete;
 
  private:
+  static constexpr Clock::time_point kNoDeadline = Clock::time_point::max();
+
+  struct Job {
+    std::function<void()> task;
+    DiscardHook onDiscard;
+  };
+
+  // Entry of the deadline lane (time = deadline) or of the timer heap (time = due)
+  struct TimedTask {
+    Clock::time_point time;
+    uint64_t sequence;
+    std::function<void()> task;
+    DiscardHook onDiscard;
+  };
+
+  // Heap comparator: the earliest time (then the lowest sequence) ends up on top
+  struct LaterTime {
+    bool operator()(const TimedTask& a, const TimedTask& b) const {
+      return a.time != b.time ? a.time > b.time : a.sequence > b.sequence;
+    }
+  };
+
+  struct PeriodicTimer {
+    Clock::duration period;
+    Clock::time_point next;
+    std::function<void()> fn;
+    CancellationTokenPtr token;
+  };
+
+  void ArmPeriodic(std::shared_ptr<PeriodicTimer> timer) {
+    Clock::time_point due = timer->next;
+    EnqueueAt(due, [this, timer = std::move(timer)]() mutable {
+      if (timer->token && timer->token->IsCancelled()) {
+        return;
+      }
+      // A throwing tick is dropped like a throwing event handler; it neither stops the timer nor reaches the worker
+      try {
+        timer->fn();
+      } catch (...) {
+      }
+
+      // Re-armed only after fn returns, so ticks of one timer never overlap; a timer cancelled meanwhile (possibly
+      // by fn itself) is not put back in the heap
+      if (timer->token && timer->token->IsCancelled()) {
+        return;
+      }
+      auto now = Clock::now();
+      do {
+        timer->next += timer->period;
+      } while (timer->next <= now);
+      ArmPeriodic(std::move(timer));
+    });
+  }
+
+  void RunTimer() {
+    std::unique_lock<std::mutex> lock(timerMutex);
+    while (!timerStop) {
+      if (timerTasks.empty()) {
+        timerCondition.wait(lock);
+        continue;
+      }
+      Clock::time_point due = timerTasks.front().time;
+      if (Clock::now() < due) {
+        timerCondition.wait_until(lock, due);
+        continue;
+      }
+
+      std::pop_heap(timerTasks.begin(), timerTasks.end(), LaterTime{});
+      std::function<void()> task = std::move(timerTasks.back().task);
+      DiscardHook onDiscard = timerTasks.back().onDiscard;
+      timerTasks.pop_back();
+      lock.unlock();
+      Enqueue(std::move(task), onDiscard);
+      lock.lock();
+    }
+  }
+
+  // Drops a job unrun; its hook, if any, completes the owner as cancelled
+  void Discard(std::function<void()> task, DiscardHook onDiscard) {
+    if (onDiscard.fn && onDiscard.fn(onDiscard.context, *this)) {
+      shutdownCancelled.fetch_add(1, std::memory_order_relaxed);
+    }
+    shutdownDiscarded.fetch_add(1, std::memory_order_relaxed);
+    task = nullptr;  // released here, outside any pool lock
+  }
+
   static size_t GetDefaultThreadCount() {
     auto core = std::thread::hardware_concurrency();
     if (core == 0) return 1;
@@ -76,8 +388,35 @@ class ThreadPool {
   }
 
   std::vector<std::thread> workers;
-  std::queue<std::function<void()>> tasks;
-  std::mutex queueMutex;
-  std::condition_variable condition;
+
+  // Queue state is only touched under queueMutex, so stop shares its line on purpose;
+  // the block is aligned so it does not false-share with the read-only members above
+  alignas(kCacheLineSize) std::mutex queueMutex;
   bool stop = false;
+  bool discarding = false;  // workers drop what they pop instead of running it
+  bool shutDown = false;    // no worker left to pop; new work is discarded on the caller's thread
+  size_t liveWorkers = 0;
+  std::queue<Job> tasks;
+  std::vector<TimedTask> deadlineTasks;  // binary heap ordered by LaterTime
+  uint64_t deadlineSequence = 0;
+  std::condition_variable condition;
+  std::condition_variable drainedCondition;  // signalled as workers exit during shutdown
+
+  // Bumped by workers after each deadline job, kept off the queue line
+  alignas(kCacheLineSize) std::atomic<uint64_t> deadlinesMet{0};
+  std::atomic<uint64_t> deadlinesMissed{0};
+  std::atomic<uint64_t> deadlinesDropped{0};
+
+  // Counted only once shutdown has started
+  std::atomic<uint64_t> shutdownExecuted{0};
+  std::atomic<uint64_t> shutdownDiscarded{0};
+  std::atomic<uint64_t> shutdownCancelled{0};
+
+  // Timer heap, served by timerThread; separate from queueMutex so arming a timer never contends with workers
+  alignas(kCacheLineSize) std::mutex timerMutex;
+  bool timerStop = false;
+  std::vector<TimedTask> timerTasks;  // binary heap ordered by LaterTime
+  uint64_t timerSequence = 0;
+  std::condition_variable timerCondition;
+  std::thread timerThread;
 };
@@ -0,0 +1,121 @@
+/**
+ * @file TopicTrie.hpp
+ * @brief Trie of dot-separated topic patterns, matched against EventName strings.
+ * @details Patterns are split on '.'; a `*` segment matches exactly one name segment and a `#` (or `**`) segment
+ *          matches zero or more. EventBus resolves each event type against the trie once and caches the result,
+ *          so matching cost is paid per (type, subscription change), never per emit.
+ *
+ * @code{.cpp}
+ * TopicTrie trie;
+ * trie.Insert("player.*", 1);
+ * trie.Insert("#", 2);
+ * trie.Match("player.damaged");  // {1, 2}
+ * trie.Match("item.picked_up");  // {2}
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class TopicTrie {
+ public:
+  void Insert(std::string_view pattern, uint64_t id) {
+    Node* node = &root_;
+    for (std::string_view segment : Split(pattern)) {
+      auto& child = node->children[Normalize(segment)];
+      if (!child) {
+        child = std::make_unique<Node>();
+      }
+      node = child.get();
+    }
+    node->ids.push_back(id);
+  }
+
+  void Remove(std::string_view pattern, uint64_t id) {
+    Remove(root_, Split(pattern), 0, id);
+  }
+
+  // Ids of every pattern matching name, in ascending (subscription) order and without duplicates
+  std::vector<uint64_t> Match(std::string_view name) const {
+    std::vector<uint64_t> ids;
+    Match(root_, Split(name), 0, ids);
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+  }
+
+  bool Empty() const {
+    return root_.children.empty() && root_.ids.empty();
+  }
+
+ private:
+  struct Node {
+    std::map<std::string, std::unique_ptr<Node>, std::less<>> children;
+    std::vector<uint64_t> ids;
+  };
+
+  static constexpr std::string_view kAnySegment = "*";
+  static constexpr std::string_view kAnySuffix = "#";
+
+  static std::string Normalize(std::string_view segment) {
+    return std::string(segment == "**" ? kAnySuffix : segment);
+  }
+
+  static std::vector<std::string_view> Split(std::string_view text) {
+    std::vector<std::string_view> segments;
+    size_t start = 0;
+    while (start <= text.size()) {
+      size_t dot = text.find('.', start);
+      if (dot == std::string_view::npos) {
+        dot = text.size();
+      }
+      segments.push_back(text.substr(start, dot - start));
+      start = dot + 1;
+    }
+    return segments;
+  }
+
+  static void Match(const Node& node, const std::vector<std::string_view>& segments, size_t index, std::vector<uint64_t>& out) {
+    if (auto it = node.children.find(kAnySuffix); it != node.children.end()) {
+      for (size_t rest = index; rest <= segments.size(); ++rest) {
+        Match(*it->second, segments, rest, out);
+      }
+    }
+
+    if (index == segments.size()) {
+      out.insert(out.end(), node.ids.begin(), node.ids.end());
+      return;
+    }
+
+    if (auto it = node.children.find(segments[index]); it != node.children.end()) {
+      Match(*it->second, segments, index + 1, out);
+    }
+    if (segments[index] != kAnySegment) {
+      if (auto it = node.children.find(kAnySegment); it != node.children.end()) {
+        Match(*it->second, segments, index + 1, out);
+      }
+    }
+  }
+
+  // Returns true when node became empty and can be pruned by its parent
+  static bool Remove(Node& node, const std::vector<std::string_view>& segments, size_t index, uint64_t id) {
+    if (index == segments.size()) {
+      std::erase(node.ids, id);
+    } else {
+      auto it = node.children.find(Normalize(segments[index]));
+      if (it != node.children.end() && Remove(*it->second, segments, index + 1, id)) {
+        node.children.erase(it);
+      }
+    }
+    return node.ids.empty() && node.children.empty();
+  }
+
+  Node root_;
+};